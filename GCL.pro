@@ -28,7 +28,9 @@
 #
 # CLASSES INCLUDED:   None
 #
-# HISTORY:            2013-06-16 GGB - File created.
+# HISTORY:            2026-10-18 GGB - Added the tsan target.
+#                     2026-10-18 GGB - Added the check and bench targets.
+#                     2013-06-16 GGB - File created.
 //
 #**********************************************************************************************************************************
 
@@ -75,6 +77,7 @@ HEADERS += \
     include/Functions.h \
     include/common.h \
     include/SQLWriter.h \
+    include/SQLStatic.hpp \
     include/dataParser/dataDelimited.h \
     include/dataParser/dataParserCore.h \
     include/dateTime.h \
@@ -90,12 +93,30 @@ HEADERS += \
     include/configurationReader/readerSections.hpp \
     include/configurationReader/readerVanilla.hpp \
     include/configurationReader/readerCore.hpp \
+    include/configurationReader/keyStore.hpp \
+    include/configurationReader/readerSchema.hpp \
     include/GCLError.h \
     include/pluginManager/pluginManager.h
 
 OTHER_FILES += \
     changelog.txt
 
+  # Unit tests (test/test.pro) and benchmarks (bench/bench.pro) are separate projects linked against the library.
+  # 'make check' builds and runs the tests, 'make bench' builds and runs the benchmarks. 'make tsan' builds and runs the
+  # tests with the thread sanitizer. (Uses a separate Makefile and objects so the normal build is not affected)
+
+check.commands = cd $$PWD/test && $$QMAKE_QMAKE test.pro && $(MAKE) && ./GCLTest
+check.depends = $(TARGET)
+
+bench.commands = cd $$PWD/bench && $$QMAKE_QMAKE bench.pro && $(MAKE) && ./GCLBench
+bench.depends = $(TARGET)
+
+tsan.commands = cd $$PWD/test && $$QMAKE_QMAKE test.pro CONFIG+=sanitizer CONFIG+=sanitize_thread -o Makefile.tsan && \
+                $(MAKE) -f Makefile.tsan && ./GCLTest-tsan
+tsan.depends = $(TARGET)
+
+QMAKE_EXTRA_TARGETS += check bench tsan
+
 DISTFILES += \
     README \
     changelog.txt
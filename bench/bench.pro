@@ -0,0 +1,65 @@
+#**********************************************************************************************************************************
+#
+# PROJECT:            General Class Library (GCL)
+# FILE:               GCL Benchmark Project File
+# SUBSYSTEM:          Project File
+# LANGUAGE:           C++17
+# TARGET OS:          All (Standard C++)
+# LIBRARY DEPENDANCE: None.
+# NAMESPACE:          GCL
+# AUTHOR:             Gavin Blakeman.
+# LICENSE:            GPLv2
+#
+#                     Copyright 2026 Gavin Blakeman.
+#                     This file is part of the General Class Library (GCL)
+#
+#                     GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+#                     Public License as published by the Free Software Foundation, either version 2 of the License, or
+#                     (at your option) any later version.
+#
+#                     GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+#                     implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+#                     for more details.
+#
+#                     You should have received a copy of the GNU General Public License along with GCL.  If not,
+#                     see <http://www.gnu.org/licenses/>.
+#
+# OVERVIEW:           The .pro file for the GCL benchmarks. Built and run by the 'bench' target in GCL.pro. The benchmarks are
+#                     always built with optimisation. Arguments to GCLBench select benchmarks by name.
+#
+# HISTORY:            2026-10-18 GGB - File created.
+#
+#**********************************************************************************************************************************
+
+TARGET = GCLBench
+TEMPLATE = app
+CONFIG += console release
+CONFIG -= app_bundle debug
+
+QT -= core gui
+
+DEFINES += BOOST_CHRONO_DONT_PROVIDES_DEPRECATED_IO_SINCE_V2_0_0
+DEFINES += BOOST_THREAD_USE_LIB
+
+QMAKE_CXXFLAGS += -std=c++17
+QMAKE_CXXFLAGS_RELEASE -= -O2
+QMAKE_CXXFLAGS_RELEASE += -O3
+
+OBJECTS_DIR = "objects"
+
+INCLUDEPATH += \
+  ".." \
+  "../../MCL" \
+  "../../SCL" \
+
+LIBS += -L$$PWD/.. -lGCL
+LIBS += -L$$PWD/../../SCL -lSCL
+LIBS += -lboost_locale -lboost_filesystem -lpthread
+
+SOURCES += \
+    benchMain.cpp \
+    benchConfigurationReader.cpp \
+    benchSQLWriter.cpp
+
+HEADERS += \
+    benchmark.h
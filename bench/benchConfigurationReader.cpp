@@ -0,0 +1,404 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								benchConfigurationReader
+// SUBSYSTEM:						Benchmarks
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+// OVERVIEW:            Benchmarks of the configuration readers. The files are generated in the temporary directory.
+//                      legacyReader is the lookup path of CReaderSections before the single pass loader and key store, and is
+//                      the baseline the readers are compared with.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#include "benchmark.h"
+
+#include "include/configurationReader/readerSections.hpp"
+#include "include/configurationReader/readerVanilla.hpp"
+
+  // Standard C++ library header files
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+  // Miscellaneous library header files
+
+#include <boost/algorithm/string/trim.hpp>
+
+namespace
+{
+  std::size_t const sectionCount = 1000;
+  std::size_t const tagCount = 20;
+
+  /// @brief      Writes a configuration file with sections of tags. The value of each tag is its tag number.
+  /// @param[in]  fileName: The name of the file in the temporary directory.
+  /// @param[in]  sections: The number of sections.
+  /// @param[in]  tags: The number of tags in each section.
+  /// @returns    The path of the file.
+
+  std::filesystem::path writeSectionsFile(std::string const &fileName, std::size_t sections, std::size_t tags)
+  {
+    std::filesystem::path returnValue = std::filesystem::temp_directory_path() / fileName;
+    std::ofstream ofs(returnValue, std::ios::trunc);
+
+    for (std::size_t section = 0; section < sections; section++)
+    {
+      ofs << "[section" << section << "]\n";
+      for (std::size_t tag = 0; tag < tags; tag++)
+      {
+        ofs << "tag" << tag << " = " << tag << "\n";
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Writes a configuration file without sections. The value of each tag is its tag number.
+  /// @param[in]  fileName: The name of the file in the temporary directory.
+  /// @param[in]  tags: The number of tags.
+  /// @returns    The path of the file.
+
+  std::filesystem::path writeVanillaFile(std::string const &fileName, std::size_t tags)
+  {
+    std::filesystem::path returnValue = std::filesystem::temp_directory_path() / fileName;
+    std::ofstream ofs(returnValue, std::ios::trunc);
+
+    for (std::size_t tag = 0; tag < tags; tag++)
+    {
+      ofs << "tag" << tag << " = " << tag << "\n";
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Returns the section and tag names of a generated file, in a scattered order.
+
+  std::vector<std::pair<std::string, std::string>> lookupNames(std::size_t sections, std::size_t tags)
+  {
+    std::vector<std::pair<std::string, std::string>> returnValue;
+
+    for (std::size_t index = 0; index < 1000; index++)
+    {
+      returnValue.emplace_back("section" + std::to_string((index * 7919) % sections), "tag" + std::to_string(index % tags));
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      The lookup path of CReaderSections before the key store was added. Values are held in nested maps. A lookup
+  ///             builds "section/tag", splits and trims it and, if the section has not been read, rescans the file from the
+  ///             start until the section has been read.
+
+  class legacyReader
+  {
+  public:
+    explicit legacyReader(std::filesystem::path fileName) : fileName_(std::move(fileName)) {}
+
+    std::optional<std::string> tagValueString(std::string const &section, std::string const &tagName)
+    {
+      return readTag(section + "/" + tagName);
+    }
+
+  private:
+    using tagValueContainer_t = std::unordered_map<std::string, std::string>;
+
+    std::filesystem::path fileName_;
+    std::unordered_map<std::string, tagValueContainer_t> sections_;
+
+    std::optional<std::string> readTag(std::string const &sectionTagName)
+    {
+      std::optional<std::string> returnValue;
+      std::string section = sectionTagName.substr(0, sectionTagName.find('/'));
+      std::string tagName = sectionTagName.substr(sectionTagName.find('/') + 1);
+
+      boost::trim(section);
+      boost::trim(tagName);
+
+      auto sectionIterator = sections_.find(section);
+
+      if (sectionIterator == sections_.end())
+      {
+        std::ifstream ifs(fileName_);
+        std::string line;
+        tagValueContainer_t *tags = nullptr;
+        bool sectionFound = false;
+        bool sectionComplete = false;
+
+        while (!sectionComplete && std::getline(ifs, line))
+        {
+          std::size_t seperator;
+
+          boost::trim(line);
+
+          if (!line.empty() && (line.front() == '['))
+          {
+            std::string name = line.substr(1, line.find(']') - 1);
+
+            sectionComplete = sectionFound;
+            sectionFound = (name == section);
+            tags = &sections_[name];
+          }
+          else if (tags && ((seperator = line.find('=')) != std::string::npos))
+          {
+            std::string tag = line.substr(0, seperator);
+            std::string value = line.substr(seperator + 1);
+
+            boost::trim(tag);
+            boost::trim(value);
+            tags->emplace(std::move(tag), std::move(value));
+          };
+        };
+
+        sectionIterator = sections_.find(section);
+      };
+
+      if (sectionIterator != sections_.end())
+      {
+        auto tagIterator = sectionIterator->second.find(tagName);
+
+        if (tagIterator != sectionIterator->second.end())
+        {
+          returnValue = tagIterator->second;
+        };
+      };
+
+      return returnValue;
+    }
+  };
+}
+
+GCL_BENCHMARK(configurationStartup)
+{
+    // A typical configuration (about 5,000 lines) and a large one. (About 100,000 lines) The legacy reader is only run on the
+    // typical file, as it rescans the file for each section.
+
+  for (std::size_t sections : {std::size_t(250), std::size_t(5000)})
+  {
+    std::filesystem::path fileName = writeSectionsFile("GCLBench-startup.ini", sections, tagCount);
+    std::uint64_t lines = sections * (tagCount + 1);
+    std::string name = "configuration/startup/lines=" + std::to_string(lines);
+
+    GCL::benchmark::report(name + "/eagerLoad", GCL::benchmark::measure([&]()
+    {
+      GCL::CReaderSections reader(fileName, "=", "#", true);
+      return lines;
+    }), "line");
+
+      // Start the reader and read every tag once.
+
+    GCL::benchmark::report(name + "/eagerAllTags", GCL::benchmark::measure([&]()
+    {
+      GCL::CReaderSections reader(fileName, "=", "#", true);
+
+      for (std::size_t section = 0; section < sections; section++)
+      {
+        std::string sectionName = "section" + std::to_string(section);
+
+        for (std::size_t tag = 0; tag < tagCount; tag++)
+        {
+          reader.tagValueString(sectionName, "tag" + std::to_string(tag));
+        };
+      };
+      return sections * tagCount;
+    }), "tag");
+
+    if (sections <= 250)
+    {
+      GCL::benchmark::report(name + "/legacyAllTags", GCL::benchmark::measure([&]()
+      {
+        legacyReader reader(fileName);
+
+        for (std::size_t section = 0; section < sections; section++)
+        {
+          std::string sectionName = "section" + std::to_string(section);
+
+          for (std::size_t tag = 0; tag < tagCount; tag++)
+          {
+            reader.tagValueString(sectionName, "tag" + std::to_string(tag));
+          };
+        };
+        return sections * tagCount;
+      }), "tag");
+    };
+
+    std::filesystem::remove(fileName);
+  };
+}
+
+GCL_BENCHMARK(configurationLookup)
+{
+  std::filesystem::path fileName = writeSectionsFile("GCLBench-lookup.ini", 250, tagCount);
+  std::vector<std::pair<std::string, std::string>> names = lookupNames(250, tagCount);
+  std::vector<std::string> combinedNames;
+  GCL::CReaderSections reader(fileName, "=", "#", true);
+  legacyReader legacy(fileName);
+
+  for (auto const &[section, tag] : names)
+  {
+    combinedNames.push_back(section + "/" + tag);
+    legacy.tagValueString(section, tag);      // Read all the sections, so only the lookup is measured.
+  };
+
+  GCL::benchmark::report("configuration/lookup/legacy", GCL::benchmark::measure([&]()
+  {
+    for (auto const &[section, tag] : names)
+    {
+      legacy.tagValueString(section, tag);
+    };
+    return names.size();
+  }), "lookup");
+
+  GCL::benchmark::report("configuration/lookup/string", GCL::benchmark::measure([&]()
+  {
+    for (auto const &[section, tag] : names)
+    {
+      reader.tagValueString(section, tag);
+    };
+    return names.size();
+  }), "lookup");
+
+  GCL::benchmark::report("configuration/lookup/sectionTagName", GCL::benchmark::measure([&]()
+  {
+    for (auto const &name : combinedNames)
+    {
+      reader.tagValueString(name);
+    };
+    return combinedNames.size();
+  }), "lookup");
+
+  GCL::benchmark::report("configuration/lookup/view", GCL::benchmark::measure([&]()
+  {
+    for (auto const &[section, tag] : names)
+    {
+      reader.tagValueView(section, tag);
+    };
+    return names.size();
+  }), "lookup");
+
+  GCL::benchmark::report("configuration/lookup/int32", GCL::benchmark::measure([&]()
+  {
+    for (auto const &[section, tag] : names)
+    {
+      reader.tagValueInt32(section, tag);
+    };
+    return names.size();
+  }), "lookup");
+
+  std::filesystem::remove(fileName);
+}
+
+GCL_BENCHMARK(configurationFormats)
+{
+    // The same number of values in each format, loaded eagerly and then looked up.
+
+  std::size_t const valueCount = sectionCount * tagCount;
+  std::filesystem::path sectionsName = writeSectionsFile("GCLBench-sections.ini", sectionCount, tagCount);
+  std::filesystem::path vanillaName = writeVanillaFile("GCLBench-vanilla.cfg", valueCount);
+  std::vector<std::pair<std::string, std::string>> names = lookupNames(sectionCount, tagCount);
+  std::vector<std::string> vanillaNames;
+
+  for (std::size_t index = 0; index < 1000; index++)
+  {
+    vanillaNames.push_back("tag" + std::to_string((index * 7919) % valueCount));
+  };
+
+  GCL::benchmark::report("configuration/formats/sections/load", GCL::benchmark::measure([&]()
+  {
+    GCL::CReaderSections reader(sectionsName, "=", "#", true);
+    return valueCount;
+  }), "value");
+
+  GCL::benchmark::report("configuration/formats/vanilla/load", GCL::benchmark::measure([&]()
+  {
+    GCL::CReaderVanilla reader(vanillaName, "=", "#", true);
+    return valueCount;
+  }), "value");
+
+  GCL::CReaderSections sections(sectionsName, "=", "#", true);
+  GCL::CReaderVanilla vanilla(vanillaName, "=", "#", true);
+
+  GCL::benchmark::report("configuration/formats/sections/lookup", GCL::benchmark::measure([&]()
+  {
+    for (auto const &[section, tag] : names)
+    {
+      sections.tagValueInt32(section, tag);
+    };
+    return names.size();
+  }), "lookup");
+
+  GCL::benchmark::report("configuration/formats/vanilla/lookup", GCL::benchmark::measure([&]()
+  {
+    for (auto const &name : vanillaNames)
+    {
+      vanilla.tagValueInt32(name);
+    };
+    return vanillaNames.size();
+  }), "lookup");
+
+  std::filesystem::remove(sectionsName);
+  std::filesystem::remove(vanillaName);
+}
+
+GCL_BENCHMARK(configurationLookupThreads)
+{
+  std::filesystem::path fileName = writeSectionsFile("GCLBench.ini", sectionCount, tagCount);
+  std::vector<std::pair<std::string, std::string>> names = lookupNames(sectionCount, tagCount);
+  GCL::CReaderSections reader(fileName, "=", "#", true);
+
+    // Converted lookups from 1..N threads sharing one reader.
+
+  for (unsigned int threadCount : GCL::benchmark::threadCounts())
+  {
+    GCL::benchmark::report("configuration/lookup/threads=" + std::to_string(threadCount), GCL::benchmark::measure([&]()
+    {
+      std::vector<std::thread> threads;
+
+      for (unsigned int thread = 0; thread < threadCount; thread++)
+      {
+        threads.emplace_back([&]()
+        {
+          for (int repeat = 0; repeat < 100; repeat++)
+          {
+            for (auto const &[section, tag] : names)
+            {
+              reader.tagValueInt32(section, tag);
+            };
+          };
+        });
+      };
+      for (auto &thread : threads)
+      {
+        thread.join();
+      };
+      return std::uint64_t(threadCount) * 100 * names.size();
+    }), "lookup");
+  };
+
+  std::filesystem::remove(fileName);
+}
@@ -0,0 +1,164 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								benchMain
+// SUBSYSTEM:						Benchmarks
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Entry point for the GCL benchmarks. Replaces the global operator new to count allocations.
+//                      Usage: GCLBench [name ...] runs the benchmarks whose names contain any of the arguments, or all of them.
+//                      GCL_BENCH_TIME sets the minimum time (seconds) of each measurement. The default is 0.5s.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#include "benchmark.h"
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  std::atomic<std::uint64_t> allocations{0};
+
+  std::vector<std::pair<std::string, std::function<void()>>> &benchmarks()
+  {
+    static std::vector<std::pair<std::string, std::function<void()>>> registry;
+    return registry;
+  }
+}
+
+void *operator new(std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+
+  if (void *returnValue = std::malloc(size == 0 ? 1 : size))
+  {
+    return returnValue;
+  };
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+namespace GCL::benchmark
+{
+  /// @brief      Returns the number of allocations made since the program started.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::uint64_t allocationCount() noexcept
+  {
+    return allocations.load(std::memory_order_relaxed);
+  }
+
+  /// @brief      Returns the minimum time of a measurement.
+  /// @version    2026-10-18/GGB - Function created.
+
+  double minimumTime() noexcept
+  {
+    static double const returnValue = std::getenv("GCL_BENCH_TIME") ? std::atof(std::getenv("GCL_BENCH_TIME")) : 0.5;
+
+    return returnValue;
+  }
+
+  /// @brief      Returns the thread counts for scaling measurements. (1, 2, 4 ... up to and including the number of cores)
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::vector<unsigned int> threadCounts()
+  {
+    std::vector<unsigned int> returnValue;
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned int count = 1; count < cores; count *= 2)
+    {
+      returnValue.push_back(count);
+    };
+    returnValue.push_back(cores);
+
+    return returnValue;
+  }
+
+  /// @brief      Adds a benchmark to the registry.
+  /// @param[in]  name: The name of the benchmark.
+  /// @param[in]  function: The benchmark.
+  /// @returns    true
+  /// @version    2026-10-18/GGB - Function created.
+
+  bool registerBenchmark(std::string const &name, std::function<void()> function)
+  {
+    benchmarks().emplace_back(name, std::move(function));
+    return true;
+  }
+
+  /// @brief      Writes a measurement as: name, operations per second, nanoseconds per operation, allocations per operation.
+  /// @param[in]  name: The name of the measurement.
+  /// @param[in]  result: The measurement.
+  /// @param[in]  unit: The name of the operation.
+  /// @version    2026-10-18/GGB - Function created.
+
+  void report(std::string const &name, SResult const &result, std::string const &unit)
+  {
+    double iterations = result.iterations ? static_cast<double>(result.iterations) : 1.0;
+
+    std::printf("%-48s %14.0f %s/s %12.1f ns/%s %10.2f allocs/%s\n", name.c_str(), iterations / result.seconds, unit.c_str(),
+                result.seconds * 1e9 / iterations, unit.c_str(), static_cast<double>(result.allocations) / iterations, unit.c_str());
+    std::fflush(stdout);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  for (auto const &[name, function] : benchmarks())
+  {
+    bool selected = (argc == 1);
+
+    for (int index = 1; index < argc && !selected; index++)
+    {
+      selected = (name.find(argv[index]) != std::string::npos);
+    };
+
+    if (selected)
+    {
+      function();
+    };
+  };
+
+  return 0;
+}
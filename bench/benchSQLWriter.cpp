@@ -0,0 +1,343 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								benchSQLWriter
+// SUBSYSTEM:						Benchmarks
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Queries rendered per second and allocations per query for representative sqlWriter workloads. The 'build'
+//                      measurements construct the query and render it. The 'render' measurements render an existing query.
+//                      The map file benchmarks read a large synthetic map file and render queries through it.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#include "benchmark.h"
+
+#include "include/SQLWriter.h"
+
+  // Standard C++ library header files
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using GCL::sqlWriter;
+
+namespace
+{
+  std::array<std::pair<sqlWriter::EDialect, char const *>, 4> const dialects
+  {{
+    { sqlWriter::MYSQL, "mysql" },
+    { sqlWriter::ORACLE, "oracle" },
+    { sqlWriter::MICROSOFT, "microsoft" },
+    { sqlWriter::POSTGRE, "postgre" },
+  }};
+
+  void buildSelect(sqlWriter &writer, int value)
+  {
+    writer.select({"ID", "Name", "Email", "Created"}).from("tbl_users").where("ID", ">", value)
+          .orderBy({{"Name", sqlWriter::ASC}}).limit(50).offset(100);
+  }
+
+  void buildInsert(sqlWriter &writer, int value)
+  {
+    writer.insertInto("tbl_users", {"ID", "Name", "Email"});
+    for (int row = 0; row < 10; row++)
+    {
+      writer.values({{value + row, std::string("name"), std::string("name@example.com")}});
+    };
+  }
+
+  void buildUpdate(sqlWriter &writer, int value)
+  {
+    writer.update("tbl_users").set("Name", std::string("name")).set("Email", std::string("email")).where("ID", "=", value);
+  }
+
+  void buildDelete(sqlWriter &writer, int value)
+  {
+    writer.deleteFrom("tbl_users").where("ID", "=", value);
+  }
+
+  void buildUpsert(sqlWriter &writer, int value)
+  {
+    writer.upsert("tbl_users").set("Name", std::string("name")).set("Email", std::string("email")).where("ID", "=", value);
+  }
+
+  void buildPredicate(sqlWriter &writer, int value)
+  {
+    writer.select({"ID"}).from("tbl_users")
+          .where(writer.predicateOr({writer.predicateCompare("ID", "=", value),
+                                     writer.predicateAnd({writer.predicateBetween("Age", 18, 65),
+                                                          writer.predicateIsNotNull("Email")})}));
+  }
+
+  std::size_t const mapTables = 5000;
+  std::size_t const mapColumns = 20;
+
+  /// @brief      Writes a synthetic map file with mapTables tables of mapColumns columns each. All names are mapped.
+  /// @returns    The path of the file.
+
+  std::filesystem::path writeMapFile()
+  {
+    std::filesystem::path returnValue = std::filesystem::temp_directory_path() / "GCLBench.map";
+    std::ofstream ofs(returnValue, std::ios::trunc);
+
+    for (std::size_t table = 0; table < mapTables; table++)
+    {
+      ofs << "TABLE [table" << table << "] = [tbl_table" << table << "]\n";
+      for (std::size_t column = 0; column < mapColumns; column++)
+      {
+        ofs << "COLUMN [column" << column << "] = [col_" << table << "_" << column << "]\n";
+      };
+      ofs << "END\n";
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Creates the tables and columns of the synthetic map file.
+
+  void createMapTables(sqlWriter &writer)
+  {
+    for (std::size_t table = 0; table < mapTables; table++)
+    {
+      std::string tableName = "table" + std::to_string(table);
+
+      writer.createTable(tableName);
+      for (std::size_t column = 0; column < mapColumns; column++)
+      {
+        writer.createColumn(tableName, "column" + std::to_string(column));
+      };
+    };
+  }
+
+  /// @brief      Stream buffer that discards its output, so that writing to the stream is not measured.
+
+  class nullBuffer : public std::streambuf
+  {
+  protected:
+    int_type overflow(int_type c) override { return c; }
+    std::streamsize xsputn(char const *, std::streamsize count) override { return count; }
+  };
+
+  /// @brief      Measures building and rendering a query, and rendering a built query, in each dialect.
+
+  template<typename F>
+  void measureQuery(std::string const &name, F build)
+  {
+    for (auto const &[dialect, dialectName] : dialects)
+    {
+      GCL::benchmark::report(name + "/build/" + dialectName, GCL::benchmark::measure([&, dialect = dialect]()
+      {
+        for (int index = 0; index < 1000; index++)
+        {
+          sqlWriter writer;
+
+          writer.setDialect(dialect);
+          build(writer, index);
+          writer.string();
+        };
+        return 1000;
+      }), "query");
+
+      sqlWriter writer;
+
+      writer.setDialect(dialect);
+      build(writer, 42);
+      GCL::benchmark::report(name + "/render/" + dialectName, GCL::benchmark::measure([&]()
+      {
+        for (int index = 0; index < 1000; index++)
+        {
+          writer.string();
+        };
+        return 1000;
+      }), "query");
+    };
+  }
+}
+
+GCL_BENCHMARK(sqlWriterSelect)
+{
+  measureQuery("sqlWriter/select", buildSelect);
+}
+
+GCL_BENCHMARK(sqlWriterInsert)
+{
+  measureQuery("sqlWriter/insert", buildInsert);
+}
+
+GCL_BENCHMARK(sqlWriterUpdate)
+{
+  measureQuery("sqlWriter/update", buildUpdate);
+}
+
+GCL_BENCHMARK(sqlWriterDelete)
+{
+  measureQuery("sqlWriter/delete", buildDelete);
+}
+
+GCL_BENCHMARK(sqlWriterUpsert)
+{
+  measureQuery("sqlWriter/upsert", buildUpsert);
+}
+
+GCL_BENCHMARK(sqlWriterPredicate)
+{
+  measureQuery("sqlWriter/predicate", buildPredicate);
+}
+
+GCL_BENCHMARK(sqlWriterMapFile)
+{
+  std::filesystem::path mapFile = writeMapFile();
+  std::uint64_t lines = mapTables * (mapColumns + 2);
+
+  GCL::benchmark::report("sqlWriter/mapFile/createTables", GCL::benchmark::measureOnce([&]()
+  {
+    sqlWriter writer;
+
+    createMapTables(writer);
+    return mapTables * (mapColumns + 1);
+  }), "name");
+
+  GCL::benchmark::report("sqlWriter/mapFile/createAndRead", GCL::benchmark::measure([&]()
+  {
+    sqlWriter writer;
+
+    createMapTables(writer);
+    writer.readMapFile(mapFile.string());
+    return lines;
+  }), "line");
+
+  sqlWriter mapped;
+
+  createMapTables(mapped);
+  mapped.readMapFile(mapFile.string());
+
+  GCL::benchmark::report("sqlWriter/mapFile/mappedSelect", GCL::benchmark::measure([&]()
+  {
+    for (std::size_t index = 0; index < 1000; index++)
+    {
+      std::string table = "table" + std::to_string((index * 7919) % mapTables);
+      std::string other = "table" + std::to_string((index * 104729) % mapTables);
+      sqlWriter writer(mapped.databaseMap());
+
+      writer.select({"column1", "column2", "column3", "column4"}).from({table})
+            .join({std::make_tuple(table, std::string("column5"), sqlWriter::JOIN_INNER, other, std::string("column6"))})
+            .where(table + ".column7", "=", 10);
+      writer.string();
+    };
+    return 1000;
+  }), "query");
+
+  std::filesystem::remove(mapFile);
+}
+
+GCL_BENCHMARK(sqlWriterIdentifier)
+{
+  std::vector<std::string> names;
+
+  for (int index = 0; index < 1000; index++)
+  {
+    names.push_back("column" + std::to_string(index));
+    sqlWriter::identifier intern(names.back());
+  };
+
+  GCL::benchmark::report("sqlWriter/identifier/empty", GCL::benchmark::measure([]()
+  {
+    for (int index = 0; index < 1000; index++)
+    {
+      sqlWriter::identifier empty;
+    };
+    return 1000;
+  }), "identifier");
+
+    // Lookups of interned names from 1..N threads.
+
+  for (unsigned int threadCount : GCL::benchmark::threadCounts())
+  {
+    GCL::benchmark::report("sqlWriter/identifier/threads=" + std::to_string(threadCount), GCL::benchmark::measure([&]()
+    {
+      std::vector<std::thread> threads;
+
+      for (unsigned int thread = 0; thread < threadCount; thread++)
+      {
+        threads.emplace_back([&names]()
+        {
+          for (int repeat = 0; repeat < 100; repeat++)
+          {
+            for (auto const &name : names)
+            {
+              sqlWriter::identifier lookup(name);
+            };
+          };
+        });
+      };
+      for (auto &thread : threads)
+      {
+        thread.join();
+      };
+      return std::uint64_t(threadCount) * 100 * names.size();
+    }), "identifier");
+  };
+}
+
+GCL_BENCHMARK(sqlWriterRenderQueries)
+{
+  std::vector<sqlWriter> queries(200000);
+
+  for (std::size_t index = 0; index < queries.size(); index++)
+  {
+    buildSelect(queries[index], static_cast<int>(index));
+  };
+
+    // Scaling from 1 to all cores, into per-thread buffers and into a stream.
+
+  for (unsigned int threadCount : GCL::benchmark::threadCounts())
+  {
+    GCL::benchmark::report("sqlWriter/renderQueries/buffers/threads=" + std::to_string(threadCount),
+                           GCL::benchmark::measure([&]()
+    {
+      sqlWriter::renderQueries(queries, threadCount);
+      return queries.size();
+    }), "query");
+  };
+
+  for (unsigned int threadCount : GCL::benchmark::threadCounts())
+  {
+    nullBuffer buffer;
+    std::ostream os(&buffer);
+
+    GCL::benchmark::report("sqlWriter/renderQueries/stream/threads=" + std::to_string(threadCount),
+                           GCL::benchmark::measure([&]()
+    {
+      sqlWriter::renderQueries(queries, os, threadCount);
+      return queries.size();
+    }), "query");
+  };
+}
@@ -0,0 +1,113 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								benchmark
+// SUBSYSTEM:						Benchmarks
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A minimal benchmark harness. Benchmarks register themselves with GCL_BENCHMARK and are run by benchMain.
+//                      measure() repeats a function until the minimum time has elapsed and counts the allocations made while
+//                      doing so. report() writes one line per measurement so that runs can be compared with diff.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_BENCH_BENCHMARK_H
+#define GCL_BENCH_BENCHMARK_H
+
+  // Standard C++ library header files
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace GCL::benchmark
+{
+  struct SResult
+  {
+    std::uint64_t iterations = 0;         ///< Number of operations performed.
+    double seconds = 0;                   ///< Elapsed wall clock time.
+    std::uint64_t allocations = 0;        ///< Number of calls to operator new while measuring.
+  };
+
+  std::uint64_t allocationCount() noexcept;
+  bool registerBenchmark(std::string const &, std::function<void()>);
+  void report(std::string const &, SResult const &, std::string const & = "ops");
+  double minimumTime() noexcept;
+  std::vector<unsigned int> threadCounts();
+
+  /// @brief      Repeatedly calls the function until the minimum time has elapsed.
+  /// @param[in]  function: The function to measure. It returns the number of operations it performed.
+  /// @returns    The measurement.
+  /// @version    2026-10-18/GGB - Function created.
+
+  template<typename F>
+  SResult measure(F &&function)
+  {
+    using clock = std::chrono::steady_clock;
+
+    SResult returnValue;
+    std::uint64_t allocations = allocationCount();
+    clock::time_point start = clock::now();
+
+    do
+    {
+      returnValue.iterations += function();
+      returnValue.seconds = std::chrono::duration<double>(clock::now() - start).count();
+    }
+    while (returnValue.seconds < minimumTime());
+
+    returnValue.allocations = allocationCount() - allocations;
+
+    return returnValue;
+  }
+
+  /// @brief      Measures a function once.
+  /// @param[in]  function: The function to measure. It returns the number of operations it performed.
+  /// @returns    The measurement.
+  /// @version    2026-10-18/GGB - Function created.
+
+  template<typename F>
+  SResult measureOnce(F &&function)
+  {
+    using clock = std::chrono::steady_clock;
+
+    SResult returnValue;
+    std::uint64_t allocations = allocationCount();
+    clock::time_point start = clock::now();
+
+    returnValue.iterations = function();
+    returnValue.seconds = std::chrono::duration<double>(clock::now() - start).count();
+    returnValue.allocations = allocationCount() - allocations;
+
+    return returnValue;
+  }
+}
+
+#define GCL_BENCHMARK(NAME) \
+  static void NAME(); \
+  static bool const NAME##Registered = GCL::benchmark::registerBenchmark(#NAME, NAME); \
+  static void NAME()
+
+#endif // GCL_BENCH_BENCHMARK_H
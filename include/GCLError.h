@@ -27,7 +27,9 @@
 //
 // CLASSES INCLUDED:    CGCLError
 //
-// HISTORY:             2020-09-20 GGB - File created
+// HISTORY:             2026-10-18 GGB - Added E_SQLWRITER_INVALIDCOLUMNNAME
+//                      2026-10-18 GGB - Added E_SQLWRITER_NOTSUPPORTED and E_SQLWRITER_WRITEERROR
+//                      2020-09-20 GGB - File created
 //
 //*********************************************************************************************************************************
 
@@ -47,6 +49,9 @@ namespace GCL
   TErrorCode const E_SQLWRITER_INVALIDTABLENAME   = 0x1003;
   TErrorCode const E_SQLWRITER_NOSELECTFIELDS     = 0x1004;
   TErrorCode const E_SQLWRITER_NOFROMFIELD        = 0x1005;
+  TErrorCode const E_SQLWRITER_NOTSUPPORTED       = 0x1006;
+  TErrorCode const E_SQLWRITER_WRITEERROR         = 0x1007;
+  TErrorCode const E_SQLWRITER_INVALIDCOLUMNNAME  = 0x1008;
 
   TErrorCode const E_PLUGINMANAGER_NODIRECTORY    = 0x1100;
   TErrorCode const E_PLUGINMANAGER_UNABLETOLOAD   = 0x1101;
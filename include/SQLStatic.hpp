@@ -0,0 +1,523 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                SQLStatic.hpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL::sqlStatic
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Compile time construction of SQL queries whose shape is fixed. The SQL text is a compile time constant
+//                      containing placeholders for the values. The placeholder style is determined by the dialect. At runtime
+//                      the values are either bound (bind()) or rendered into the text as literals (render()).
+//                      The text produced by render() is the same as the text produced by sqlWriter for the equivalent query.
+//                      Typical select query would be written as follows:
+//                      @code
+//                      constexpr auto query = sqlStatic::select<sqlWriter::POSTGRE>("ID", "Name").from("tbl_employees")
+//                                             .where<std::uint32_t>("ID", "=");
+//                      query.string();     // SELECT ID, Name FROM tbl_employees WHERE (ID = $1)
+//                      query.render(12);   // SELECT ID, Name FROM tbl_employees WHERE (ID = 12)
+//                      @endcode
+//
+// CLASSES INCLUDED:    fixedString
+//                      query
+//
+// HISTORY:             2026-10-18 GGB - Bind values and NULL rendered as by sqlWriter.
+//                      2026-10-18 GGB - ORDER BY terms separated by ", " to match sqlWriter.
+//                      2026-10-18 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLSTATIC_HPP
+#define GCL_SQLSTATIC_HPP
+
+#ifndef GCL_CONTROL
+
+  // Standard C++ library header files
+
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+  // GCL library header files
+
+#include "include/SQLWriter.h"
+
+namespace GCL::sqlStatic
+{
+  /// @brief    Fixed length string that can be constructed and concatenated at compile time.
+
+  template<std::size_t N>
+  class fixedString
+  {
+  public:
+    char value[N + 1] {};
+
+    constexpr fixedString() = default;
+    constexpr fixedString(char const (&s)[N + 1])
+    {
+      for (std::size_t index = 0; index < N; index++)
+      {
+        value[index] = s[index];
+      };
+    }
+
+    constexpr std::size_t size() const noexcept { return N; }
+    constexpr char const *c_str() const noexcept { return value; }
+    constexpr std::string_view view() const noexcept { return std::string_view(value, N); }
+  };
+
+  template<std::size_t N>
+  fixedString(char const (&)[N]) -> fixedString<N - 1>;
+
+  template<std::size_t N, std::size_t M>
+  constexpr fixedString<N + M> operator+(fixedString<N> const &lhs, fixedString<M> const &rhs)
+  {
+    fixedString<N + M> returnValue;
+
+    for (std::size_t index = 0; index < N; index++)
+    {
+      returnValue.value[index] = lhs.value[index];
+    };
+    for (std::size_t index = 0; index < M; index++)
+    {
+      returnValue.value[N + index] = rhs.value[index];
+    };
+
+    return returnValue;
+  }
+
+  template<std::size_t N, std::size_t M>
+  constexpr fixedString<N + M - 1> operator+(fixedString<N> const &lhs, char const (&rhs)[M])
+  {
+    return lhs + fixedString<M - 1>(rhs);
+  }
+
+  namespace details
+  {
+    constexpr std::size_t digitCount(std::uint64_t value) noexcept
+    {
+      std::size_t returnValue = 1;
+
+      while (value >= 10)
+      {
+        value /= 10;
+        returnValue++;
+      };
+
+      return returnValue;
+    }
+
+    template<std::uint64_t V>
+    constexpr fixedString<digitCount(V)> numberString()
+    {
+      fixedString<digitCount(V)> returnValue;
+      std::uint64_t value = V;
+
+      for (std::size_t index = digitCount(V); index > 0; index--)
+      {
+        returnValue.value[index - 1] = static_cast<char>('0' + (value % 10));
+        value /= 10;
+      };
+
+      return returnValue;
+    }
+
+    /// @brief    Placeholder for parameter I (1 based). POSTGRE uses $n, ORACLE uses :n, MYSQL and MICROSOFT (ODBC) use ?.
+
+    template<sqlWriter::EDialect D, std::size_t I>
+    constexpr auto placeholder()
+    {
+      if constexpr (D == sqlWriter::POSTGRE)
+      {
+        return fixedString("$") + numberString<I>();
+      }
+      else if constexpr (D == sqlWriter::ORACLE)
+      {
+        return fixedString(":") + numberString<I>();
+      }
+      else
+      {
+        return fixedString("?");
+      };
+    }
+
+    template<std::size_t N, std::size_t... M>
+    constexpr auto join(char const (&first)[N], char const (&... rest)[M])
+    {
+      if constexpr (sizeof...(M) == 0)
+      {
+        return fixedString(first);
+      }
+      else
+      {
+        return fixedString(first) + ", " + join(rest...);
+      };
+    }
+
+    template<std::size_t P>
+    constexpr std::array<std::size_t, P + 1> appendOffset(std::array<std::size_t, P> const &offsets, std::size_t offset)
+    {
+      std::array<std::size_t, P + 1> returnValue {};
+
+      for (std::size_t index = 0; index < P; index++)
+      {
+        returnValue[index] = offsets[index];
+      };
+      returnValue[P] = offset;
+
+      return returnValue;
+    }
+
+      // Literal values rendered in the same way as sqlWriter. Strings are quoted, other values are converted.
+
+    inline std::string literal(std::string const &value) { return "'" + value + "'"; }
+    inline std::string literal(std::string_view value) { return "'" + std::string(value) + "'"; }
+    inline std::string literal(char const *value) { return "'" + std::string(value) + "'"; }
+    inline std::string literal(sqlWriter::nullValue const &value) { return value.to_string(); }
+
+    /// @brief      Bind values are prefixed with ':' unless they already start with ':' or '?'. (As sqlWriter::valueString())
+
+    inline std::string literal(sqlWriter::bindValue const &value)
+    {
+      std::string returnValue = value.to_string();
+
+      if (returnValue.empty() || ((returnValue.front() != ':') && (returnValue.front() != '?')))
+      {
+        returnValue.insert(0, 1, ':');
+      };
+
+      return returnValue;
+    }
+
+    template<typename T>
+    std::enable_if_t<std::is_arithmetic_v<T>, std::string> literal(T value)
+    {
+      if constexpr (std::is_integral_v<T>)
+      {
+        return std::to_string(value);
+      }
+      else
+      {
+        std::ostringstream os;
+
+        os << value;
+        return os.str();
+      };
+    }
+  }
+
+  enum EClause
+  {
+    cl_select,
+    cl_from,
+    cl_where,
+    cl_orderBy,
+    cl_limit,
+    cl_insert,
+    cl_update,
+    cl_set,
+    cl_delete,
+  };
+
+  /// @brief    A query with a compile time constant text. The clause (C) determines which clauses can follow. Params are the types
+  ///           of the values, in the order they appear in the text.
+  /// @note     All the member functions that add clauses are constexpr and return a new query type.
+
+  template<sqlWriter::EDialect D, EClause C, std::size_t N, typename... Params>
+  class query
+  {
+  public:
+    using parameters_t = std::tuple<Params...>;
+    static constexpr std::size_t parameterCount = sizeof...(Params);
+
+    fixedString<N> text;                                    ///< The query text with placeholders.
+    std::array<std::size_t, sizeof...(Params)> offsets;     ///< Offsets of the placeholders in the text.
+
+    constexpr query(fixedString<N> const &t, std::array<std::size_t, sizeof...(Params)> const &o) : text(t), offsets(o) {}
+
+    /// @brief    Returns the query text with placeholders.
+
+    constexpr std::string_view string() const noexcept { return text.view(); }
+
+    /// @brief    Adds the FROM clause to a select query.
+
+    template<std::size_t M>
+    constexpr auto from(char const (&table)[M]) const
+    {
+      static_assert(C == cl_select, "from() must follow select().");
+
+      return make<cl_from>(text + " FROM " + table, offsets);
+    }
+
+    /// @brief    Adds a where clause with a value of type T. Multiple where clauses are joined with AND.
+
+    template<typename T, std::size_t M, std::size_t O>
+    constexpr auto where(char const (&column)[M], char const (&operatorString)[O]) const
+    {
+      static_assert((C == cl_from) || (C == cl_where) || (C == cl_set) || (C == cl_delete),
+                    "where() must follow from(), set(), deleteFrom() or where().");
+
+      if constexpr (C == cl_where)
+      {
+        return addParameter<cl_where, T>(text + " AND (" + column + " " + operatorString + " ", ")");
+      }
+      else
+      {
+        return addParameter<cl_where, T>(text + " WHERE (" + column + " " + operatorString + " ", ")");
+      };
+    }
+
+    /// @brief    Adds an ORDER BY term. The text matches the text produced by sqlWriter.
+
+    template<sqlWriter::EOrderBy O = sqlWriter::ASC, std::size_t M>
+    constexpr auto orderBy(char const (&column)[M]) const
+    {
+      static_assert((C == cl_from) || (C == cl_where) || (C == cl_orderBy), "orderBy() must follow from() or where().");
+
+      constexpr auto direction = [] { if constexpr (O == sqlWriter::ASC) { return fixedString(" ASC "); }
+                                      else { return fixedString(" DESC "); }; }();
+
+      if constexpr (C == cl_orderBy)
+      {
+          // Replace the trailing space of the previous term with the separator.
+
+        fixedString<N - 1> previous;
+
+        for (std::size_t index = 0; index < N - 1; index++)
+        {
+          previous.value[index] = text.value[index];
+        };
+        return make<cl_orderBy>(previous + ", " + column + direction, offsets);
+      }
+      else
+      {
+        return make<cl_orderBy>(text + " ORDER BY " + column + direction, offsets);
+      };
+    }
+
+    /// @brief    Adds a compile time limit. MICROSOFT uses TOP in the select clause and is not supported.
+
+    template<std::uint64_t L>
+    constexpr auto limit() const
+    {
+      static_assert((C == cl_from) || (C == cl_where) || (C == cl_orderBy), "limit() must follow from(), where() or orderBy().");
+      static_assert(D != sqlWriter::MICROSOFT, "limit() is not supported for MICROSOFT.");
+
+      constexpr bool needSpace = (C != cl_orderBy);      // ORDER BY terms are followed by a space.
+
+      if constexpr (D == sqlWriter::ORACLE)
+      {
+        if constexpr (needSpace)
+        {
+          return make<cl_limit>(text + " FETCH NEXT " + details::numberString<L>() + " ROWS ONLY ", offsets);
+        }
+        else
+        {
+          return make<cl_limit>(text + "FETCH NEXT " + details::numberString<L>() + " ROWS ONLY ", offsets);
+        };
+      }
+      else
+      {
+        if constexpr (needSpace)
+        {
+          return make<cl_limit>(text + " LIMIT " + details::numberString<L>() + " ", offsets);
+        }
+        else
+        {
+          return make<cl_limit>(text + "LIMIT " + details::numberString<L>() + " ", offsets);
+        };
+      };
+    }
+
+    /// @brief    Adds a set clause to an update query with a value of type T.
+
+    template<typename T, std::size_t M>
+    constexpr auto set(char const (&column)[M]) const
+    {
+      static_assert((C == cl_update) || (C == cl_set), "set() must follow update() or set().");
+
+      if constexpr (C == cl_set)
+      {
+        return addParameter<cl_set, T>(text + ", " + column + " = ", "");
+      }
+      else
+      {
+        return addParameter<cl_set, T>(text + "SET " + column + " = ", "");
+      };
+    }
+
+    /// @brief    Returns the values as a tuple, ready for binding to the placeholders.
+
+    parameters_t bind(Params const &... values) const { return parameters_t(values...); }
+
+    /// @brief    Renders the query with the values inserted as literals.
+    /// @throws   std::bad_alloc
+
+    std::string render(Params const &... values) const
+    {
+      std::array<std::string, sizeof...(Params)> literals { details::literal(values)... };
+      std::string_view sv = text.view();
+      std::string returnValue;
+      std::size_t position = 0;
+      std::size_t length = 0;
+
+      for (auto const &element : literals)
+      {
+        length += element.size();
+      };
+      returnValue.reserve(N + length);
+
+      for (std::size_t index = 0; index < sizeof...(Params); index++)
+      {
+        std::size_t placeholderEnd = offsets[index] + 1;
+
+        while ((placeholderEnd < N) && (sv[placeholderEnd] >= '0') && (sv[placeholderEnd] <= '9') && (sv[offsets[index]] != '?'))
+        {
+          placeholderEnd++;
+        };
+
+        returnValue.append(sv.substr(position, offsets[index] - position));
+        returnValue.append(literals[index]);
+        position = placeholderEnd;
+      };
+      returnValue.append(sv.substr(position));
+
+      return returnValue;
+    }
+
+  private:
+    template<EClause NC, std::size_t M, typename... P>
+    static constexpr query<D, NC, M, P...> makeWith(fixedString<M> const &t, std::array<std::size_t, sizeof...(P)> const &o)
+    {
+      return query<D, NC, M, P...>(t, o);
+    }
+
+    template<EClause NC, std::size_t M>
+    static constexpr auto make(fixedString<M> const &t, std::array<std::size_t, sizeof...(Params)> const &o)
+    {
+      return makeWith<NC, M, Params...>(t, o);
+    }
+
+    template<EClause NC, typename T, std::size_t M, std::size_t S>
+    constexpr auto addParameter(fixedString<M> const &prefix, char const (&suffix)[S]) const
+    {
+      return makeWith<NC, M + details::placeholder<D, sizeof...(Params) + 1>().size() + S - 1, Params..., T>(
+            prefix + details::placeholder<D, sizeof...(Params) + 1>() + suffix, details::appendOffset(offsets, M));
+    }
+  };
+
+  /// @brief    Starts a select query.
+  /// @param[in] columns: The columns to select.
+
+  template<sqlWriter::EDialect D = sqlWriter::MYSQL, std::size_t... M>
+  constexpr auto select(char const (&... columns)[M])
+  {
+    static_assert(sizeof...(M) != 0, "select() requires at least one column.");
+
+    auto t = fixedString("SELECT ") + details::join(columns...);
+    return query<D, cl_select, t.size()>(t, {});
+  }
+
+  /// @brief    Starts an update query.
+
+  template<sqlWriter::EDialect D = sqlWriter::MYSQL, std::size_t M>
+  constexpr auto update(char const (&table)[M])
+  {
+    auto t = fixedString("UPDATE ") + table + " ";
+    return query<D, cl_update, t.size()>(t, {});
+  }
+
+  /// @brief    Starts a delete query.
+
+  template<sqlWriter::EDialect D = sqlWriter::MYSQL, std::size_t M>
+  constexpr auto deleteFrom(char const (&table)[M])
+  {
+    auto t = fixedString("DELETE FROM ") + table;
+    return query<D, cl_delete, t.size()>(t, {});
+  }
+
+  namespace details
+  {
+    template<sqlWriter::EDialect D, std::size_t I, typename... Ts>
+    struct valuesList;
+
+    template<sqlWriter::EDialect D, std::size_t I>
+    struct valuesList<D, I>
+    {
+      static constexpr auto text() { return fixedString(""); }
+    };
+
+    template<sqlWriter::EDialect D, std::size_t I, typename T, typename... Ts>
+    struct valuesList<D, I, T, Ts...>
+    {
+      static constexpr auto text()
+      {
+        if constexpr (sizeof...(Ts) == 0)
+        {
+          return placeholder<D, I>();
+        }
+        else
+        {
+          return placeholder<D, I>() + ", " + valuesList<D, I + 1, Ts...>::text();
+        };
+      }
+    };
+
+    template<sqlWriter::EDialect D, std::size_t P>
+    constexpr std::array<std::size_t, P> valueOffsets(std::size_t start)
+    {
+      std::array<std::size_t, P> returnValue {};
+      std::size_t offset = start;
+
+      for (std::size_t index = 0; index < P; index++)
+      {
+        returnValue[index] = offset;
+        offset += 1 + ((D == sqlWriter::POSTGRE) || (D == sqlWriter::ORACLE) ? digitCount(index + 1) : 0) + 2;
+      };
+
+      return returnValue;
+    }
+  }
+
+  /// @brief    Creates an insert query for a single row. Ts are the types of the values, one per column.
+  /// @code insertInto<sqlWriter::MYSQL, std::uint32_t, std::string>("tbl_names", "ID", "Name") @endcode
+
+  template<sqlWriter::EDialect D, typename... Ts, std::size_t M, std::size_t... C>
+  constexpr auto insertInto(char const (&table)[M], char const (&... columns)[C])
+  {
+    static_assert(sizeof...(Ts) == sizeof...(C), "insertInto() requires one type per column.");
+    static_assert(sizeof...(C) != 0, "insertInto() requires at least one column.");
+
+    auto prefix = fixedString("INSERT INTO ") + table + "(" + details::join(columns...) + ") VALUES (";
+    auto t = prefix + details::valuesList<D, 1, Ts...>::text() + ")";
+
+    return query<D, cl_insert, t.size(), Ts...>(t, details::valueOffsets<D, sizeof...(Ts)>(prefix.size()));
+  }
+
+}   // namespace GCL::sqlStatic
+
+#endif // GCL_CONTROL
+
+#endif // GCL_SQLSTATIC_HPP
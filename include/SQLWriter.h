@@ -31,7 +31,21 @@
 //
 // CLASSES INCLUDED:    CSQLWriter
 //
-// HISTORY:             2020-04-25 GGB - Added offset functionality.
+// HISTORY:             2026-10-18 GGB - Added index and optimiser hints.
+//                      2026-10-18 GGB - Added common table expressions and window functions.
+//                      2026-10-18 GGB - Added aggregates, GROUP BY (with ROLLUP) and HAVING.
+//                      2026-10-18 GGB - Added interned identifiers and identifier quoting.
+//                      2026-10-18 GGB - Added parallel rendering of queries.
+//                      2026-10-18 GGB - Added validation of table and column names.
+//                      2026-10-18 GGB - Added bulk load (COPY, LOAD DATA) queries and payload writer.
+//                      2026-10-18 GGB - Added batched update queries.
+//                      2026-10-18 GGB - Corrected table aliases, FULL JOIN, ORDER BY and empty WHERE clauses.
+//                      2026-10-18 GGB - Shared database map and copy-on-write query storage.
+//                      2026-10-18 GGB - Added predicate expressions for where clauses.
+//                      2026-10-18 GGB - LIMIT/OFFSET and UPSERT for all dialects. Added keyset pagination.
+//                      2026-10-18 GGB - Added the rendered query cache.
+//                      2026-10-18 GGB - Hash indexed database map and memory mapped map file reader.
+//                      2020-04-25 GGB - Added offset functionality.
 //                      2019-12-08 GGB - Added UPSERT functionality for MYSQL.
 //                      2015-09-22 GGB - AIRDAS 2015.09 release
 //                      2013-01-26 GGB - Development of class for application AIRDAS
@@ -45,14 +59,23 @@
 
   // Standard Header Files
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <deque>
+#include <iosfwd>
 #include <initializer_list>
+#include <limits>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -73,25 +96,143 @@
 /// @section sec2 class CSQLWriter
 /// There is a single class that implements the SQL Writer.
 /// This is placed in the GCL::sqlWriter namespace.
+/// @section sec3 Sharing and forking
+/// The database map is held as a shared immutable object. Writers that are copied (or created from the same map) share the map,
+/// and a writer that modifies the map takes a private copy first. The query clauses are held in copy-on-write storage, so a
+/// copy of a writer shares all the clauses with the original until one of them adds to a clause. A base query can be built once
+/// and then forked (copied) per request, with only the additional clauses being allocated.
+/// A writer is not thread safe, but a writer that is not being modified may be forked from any number of threads at once.
+/// @section sec4 Batched updates
+/// updateBatch() updates many rows, identified by a key column, in one statement. Each row passed to values() is the key value
+/// followed by the column values. MYSQL, MICROSOFT and ORACLE use @code UPDATE t SET c = CASE k WHEN ... END WHERE k IN (...)
+/// @endcode and POSTGRE uses @code UPDATE t SET c = v.c FROM (VALUES ...) AS v(k, c) WHERE t.k = v.k @endcode
+/// strings() splits the rows across as many statements as needed to keep each statement within a maximum length.
+/// @section sec5 Name validation
+/// If validation is enabled with setValidation(true), the table and column names are checked against the database map when they
+/// are added to the query, and an exception is thrown if a name is not known. Each column name is resolved to its column ID
+/// once, and rendering then uses the ID directly instead of looking the name up again. Validation costs at most two hash lookups
+/// per name. (An unqualified name that is in more than one table is also checked against each table already in the query)
+/// Wildcards and expressions (names containing '*' or '(') are not validated.
+/// @section sec6 Parallel rendering
+/// renderQueries() renders a vector of queries on a number of threads. Each thread renders a contiguous block of queries into its
+/// own buffer, and the output is in the same order as the input. The vector version returns the per-thread buffers in a
+/// renderedQueries object, which gives each query as a std::string_view into its buffer, so there is no allocation per query. The
+/// stream version writes each block as soon as all the blocks before it are written, so only a few blocks per thread are held in
+/// memory.
+/// @section sec7 Identifiers
+/// Table, column and alias names in the select, from and join clauses are held as interned identifiers. An identifier is a
+/// pointer sized handle into a global table of names that is never released, so storing or copying a name does not allocate
+/// once the name has been seen. Each entry also holds the name quoted for each dialect. (`name` for MYSQL, "name" for POSTGRE and
+/// ORACLE, [name] for MICROSOFT) If quoting is enabled with setIdentifierQuoting(true), all table and column names are quoted
+/// when the query is rendered, so reserved words may be used as names. Qualified names are quoted per part (`t`.`c`), wildcards
+/// are not quoted, and names that are expressions (eg COUNT(*)) are output unchanged.
+/// @section sec8 Aggregates
+/// aggregate() adds an aggregate expression (COUNT, COUNT DISTINCT, SUM, AVG, MIN, MAX) to the select clause, and sum() and avg()
+/// are shortcuts in the same way as min() and max(). groupBy() adds the GROUP BY clause, optionally with ROLLUP. (WITH ROLLUP for
+/// MYSQL, ROLLUP (...) for the other dialects) having() adds conditions on aggregates or grouped columns to the HAVING clause.
+/// @code
+/// sql.select({"region"}).sum("amount", "total").from("sales").groupBy({"region"}).having(sqlWriter::AGG_SUM, "amount", ">", 1000);
+/// @endcode
+/// @section sec9 Common table expressions and window functions
+/// with() adds a common table expression (WITH name (columns) AS (query)) to a select query, and withRecursive() adds a recursive
+/// expression made of an anchor query and a recursive query joined with UNION ALL. The queries are rendered when they are added.
+/// with() must be called after select(), as select() resets the query. window() adds a window function to the select clause,
+/// eg ROW_NUMBER() OVER (PARTITION BY ... ORDER BY ...), so that ranking and deduplication can be done by the database.
+/// @code
+/// sqlWriter ranked;
+/// ranked.select({"id", "name"}).window(sqlWriter::WIN_ROW_NUMBER, "", {"name"}, {{"updated", sqlWriter::DESC}}, "rn")
+///       .from("customers");
+/// sql.select({"id", "name"}).with("ranked", ranked).from("ranked").where("rn", "=", 1);
+/// @endcode
+/// @section sec10 Hints
+/// indexHint() and queryHint() add index and optimiser hints to a select query. Each hint is output in the position required by
+/// the dialect:
+/// @li MYSQL: USE/FORCE/IGNORE INDEX (...) after the table in the FROM clause. Query hints are output as /*+ ... */ after SELECT.
+/// @li MICROSOFT: WITH (INDEX(...)) after the table in the FROM clause. Query hints are output as OPTION (...) at the end of the
+/// query. IGNORE is not supported.
+/// @li ORACLE: INDEX(table index) and NO_INDEX(table index) are output with the query hints as /*+ ... */ after SELECT. The table
+/// alias is used if the table has one.
+/// @li POSTGRE: Hints are output in the pg_hint_plan form as /*+ ... */ at the start of the query, using IndexScan(table index)
+/// and NoIndexScan(table). They are ignored if the extension is not loaded.
+/// @section sec11 Bulk loading
+/// bulkLoad() creates the control statement for a bulk load. (COPY ... FROM STDIN for POSTGRE, LOAD DATA LOCAL INFILE for
+/// MYSQL) The data is written with a bulkLoadWriter, obtained from bulkWriter(), that escapes and buffers the rows and writes
+/// them to a stream or file descriptor as it goes, so the payload is never held in memory.
 
 namespace GCL
 {
   class sqlWriter
   {
-  private:
-    struct SColumnData
+  public:
+    /// @brief    The database map holds the tables and columns known to the writer, along with any user mappings loaded from a
+    ///           map file.
+    /// @details  Tables and columns are interned into stable storage and identified by integer ID's. The indexes use
+    ///           std::string_view keys that refer to the interned names, so lookups do not allocate. Copying rebuilds the
+    ///           indexes against the new storage.
+    ///           Every change to the map takes a new version from a process wide counter, so the version identifies both the
+    ///           map and its contents. A copy has the version of its source, as it renders identically. An empty map has
+    ///           version zero.
+
+    class CDatabaseMap
     {
-      std::pair<std::string, std::string> columnName;           ///< TableName, ColumnName
-      bool unique;
-    };
-    typedef std::map<std::string, SColumnData> TColumnMap;
+    public:
+      using tableID_t = std::uint32_t;
+      using columnID_t = std::uint32_t;
+
+      static constexpr columnID_t AMBIGUOUS_COLUMN = std::numeric_limits<columnID_t>::max();
+
+      struct SColumnData
+      {
+        tableID_t tableID;                                ///< The table that owns the column.
+        std::string columnName;                           ///< The column name used by the application.
+        std::string columnMap;                            ///< The column name in the database. (Empty if not mapped)
+        bool unique = false;
+      };
+
+      struct STableData
+      {
+        std::string tableName;                            ///< The table name used by the application.
+        std::string tableMap;                             ///< The table name in the database. (Empty if not mapped)
+        std::unordered_map<std::string_view, columnID_t> columnIndex;
+      };
 
-    struct STableData
-    {
-      std::pair<std::string, std::string> tableName;            ///<
-      TColumnMap columnData;
+    private:
+      std::deque<STableData> tableData;                   ///< std::deque does not move elements when growing.
+      std::deque<SColumnData> columnData;
+      std::unordered_map<std::string_view, tableID_t> tableIndex;
+      std::unordered_map<std::string_view, columnID_t> columnIndex;   ///< Unqualified column names.
+      std::uint64_t version_ = 0;                         ///< Changed whenever the map is changed.
+
+      void rebuildIndex();
+      void changed() noexcept;
+
+    public:
+      CDatabaseMap() = default;
+      CDatabaseMap(CDatabaseMap const &);
+      CDatabaseMap(CDatabaseMap &&) = default;
+      CDatabaseMap &operator=(CDatabaseMap const &);
+      CDatabaseMap &operator=(CDatabaseMap &&) = default;
+
+      std::optional<tableID_t> createTable(std::string_view);
+      std::optional<columnID_t> createColumn(tableID_t, std::string_view);
+
+      std::optional<tableID_t> findTable(std::string_view) const;
+      std::optional<columnID_t> findColumn(tableID_t, std::string_view) const;
+      std::optional<columnID_t> findColumn(std::string_view) const;
+      bool hasColumn(std::string_view columnName) const { return columnIndex.find(columnName) != columnIndex.end(); }
+
+      void setTableMap(tableID_t tableID, std::string_view tableMap) { tableData[tableID].tableMap = tableMap; changed(); }
+      void setColumnMap(columnID_t columnID, std::string_view columnMap) { columnData[columnID].columnMap = columnMap; changed(); }
+
+      STableData const &table(tableID_t tableID) const { return tableData[tableID]; }
+      SColumnData const &column(columnID_t columnID) const { return columnData[columnID]; }
+
+      std::string_view mappedTableName(tableID_t) const;
+      std::string_view mappedColumnName(columnID_t) const;
+
+      bool empty() const noexcept { return tableData.empty(); }
+      std::uint64_t version() const noexcept { return version_; }
     };
-    typedef std::map<std::string, STableData> TDatabaseMap;
 
   public:
     enum EOrderBy
@@ -113,6 +254,72 @@ namespace GCL
       JOIN_LEFT,      ///< Outer Left Join
       JOIN_FULL       ///< Full outer join
     };
+    enum EAggregate
+    {
+      AGG_COUNT,          ///< COUNT(column)
+      AGG_COUNT_DISTINCT, ///< COUNT(DISTINCT column)
+      AGG_SUM,            ///< SUM(column)
+      AGG_AVG,            ///< AVG(column)
+      AGG_MIN,            ///< MIN(column)
+      AGG_MAX,            ///< MAX(column)
+    };
+    enum EWindowFunction
+    {
+      WIN_ROW_NUMBER,     ///< ROW_NUMBER()
+      WIN_RANK,           ///< RANK()
+      WIN_DENSE_RANK,     ///< DENSE_RANK()
+      WIN_LAG,            ///< LAG(column)
+      WIN_LEAD,           ///< LEAD(column)
+      WIN_FIRST_VALUE,    ///< FIRST_VALUE(column)
+      WIN_LAST_VALUE,     ///< LAST_VALUE(column)
+      WIN_AGGREGATE,      ///< Aggregate function over a window. (See EAggregate)
+    };
+    enum EIndexHint
+    {
+      HINT_USE_INDEX,     ///< Use one of the indexes.
+      HINT_FORCE_INDEX,   ///< Use one of the indexes, and do not scan the table.
+      HINT_IGNORE_INDEX,  ///< Do not use the indexes.
+    };
+    enum EBulkFormat
+    {
+      BULK_TEXT,      ///< Tab delimited, backslash escaped. NULL is \N
+      BULK_CSV,       ///< Comma delimited, strings quoted with '"'.
+    };
+
+    /// @brief    Interned table, column or alias name. The identifier is a handle to an entry in a global table that is never
+    ///           released, so identifiers are pointer sized, are copied and compared without allocation, and are safe to use from
+    ///           any thread. The entry holds the name pre-rendered in the quoted form of each dialect.
+
+    class identifier
+    {
+    private:
+      struct SIdentifierData
+      {
+        std::string name;
+        std::array<std::string, 4> quotedName;            ///< Indexed by EDialect.
+      };
+
+      SIdentifierData const *data_;
+
+      static SIdentifierData const *emptyData() noexcept;
+      static SIdentifierData const *intern(std::string_view);
+
+    public:
+      identifier() : data_(emptyData()) {}
+      identifier(std::string_view name) : data_(intern(name)) {}
+      identifier(std::string const &name) : data_(intern(name)) {}
+      identifier(char const *name) : data_(intern(name)) {}
+
+      std::string const &str() const noexcept { return data_->name; }
+      std::string const &quoted(EDialect dialect) const noexcept { return data_->quotedName[dialect]; }
+      bool empty() const noexcept { return data_->name.empty(); }
+      std::uint64_t key() const noexcept { return reinterpret_cast<std::uintptr_t>(data_); }
+
+      bool operator==(identifier const &rhs) const noexcept { return data_ == rhs.data_; }
+      bool operator!=(identifier const &rhs) const noexcept { return data_ != rhs.data_; }
+
+      static std::string quote(std::string_view, EDialect);
+    };
 
     class bindValue
     {
@@ -124,6 +331,15 @@ namespace GCL
       bindValue(std::string const &st) : value(st) {}
 
       std::string to_string() const { return value; }
+      std::string const &str() const noexcept { return value; }
+    };
+
+    /// @brief    Value that is rendered as NULL.
+
+    class nullValue
+    {
+    public:
+      std::string to_string() const { return "NULL"; }
     };
 
     using parameter = SCL::any;
@@ -142,11 +358,184 @@ namespace GCL
     typedef std::tuple<std::string, std::string, EJoin, std::string, std::string> parameterJoin;
 
     typedef std::vector<parameterJoin> joinStorage;
+    typedef std::pair<identifier, identifier> identifierPair;
+    typedef std::tuple<EAggregate, std::string, std::string> aggregate_t;                         ///< Function, column, alias
+    typedef std::tuple<std::optional<EAggregate>, std::string, std::string, parameter> having_t;  ///< Function, column, op, value
+    typedef std::tuple<identifier, identifier, EJoin, identifier, identifier> identifierJoin;
+
+    /// @brief    Handle to a predicate held in the predicate arena of a writer. Handles are only valid for the writer that created
+    ///           them (and forks made after they were created), until resetWhere() or resetQuery() is called. Each predicate
+    ///           has a unique ID, so a handle from another writer is rejected even if the index is in range.
+
+    struct predicate_t
+    {
+      std::uint32_t index;
+      std::uint64_t id = 0;                       ///< The ID of the predicate. Not used for child predicates.
+    };
+
+    /// @brief    Structural fingerprint of the builder state. Two independent 64 bit hashes are used so that the chance of two
+    ///           different queries sharing a fingerprint is negligible.
+
+    struct fingerprint_t
+    {
+      std::uint64_t hash1;
+      std::uint64_t hash2;
+
+      bool operator==(fingerprint_t const &rhs) const noexcept { return (hash1 == rhs.hash1) && (hash2 == rhs.hash2); }
+    };
+
+    /// @brief    Bounded LRU cache of rendered query strings keyed on the structural fingerprint of the builder.
+    /// @details  A cache is attached to a writer with setQueryCache() and may be shared between writers and threads. All writers
+    ///           sharing a cache may use different database maps, as the map version is part of the fingerprint.
+
+    class queryCache
+    {
+    private:
+      struct fingerprintHash
+      {
+        std::size_t operator()(fingerprint_t const &fp) const noexcept { return static_cast<std::size_t>(fp.hash1); }
+      };
+
+      using entryList_t = std::list<std::pair<fingerprint_t, std::string>>;
+      using entryMap_t = std::unordered_map<fingerprint_t, entryList_t::iterator, fingerprintHash>;
+
+      mutable std::mutex cacheMutex;
+      std::size_t capacity_;
+      entryList_t entryList;                ///< Most recently used entry is at the front.
+      entryMap_t entryMap;
+      std::atomic<std::uint64_t> hits_ = 0;
+      std::atomic<std::uint64_t> misses_ = 0;
+
+      queryCache() = delete;
+      queryCache(queryCache const &) = delete;
+      queryCache(queryCache &&) = delete;
+      queryCache &operator=(queryCache const &) = delete;
+
+    public:
+      explicit queryCache(std::size_t capacity) : capacity_(capacity) {}
+
+      std::optional<std::string> find(fingerprint_t const &);
+      void insert(fingerprint_t const &, std::string const &);
+      void clear();
+
+      std::size_t capacity() const noexcept { return capacity_; }
+      std::size_t size() const;
+      std::uint64_t hits() const noexcept { return hits_; }
+      std::uint64_t misses() const noexcept { return misses_; }
+    };
+
+    /// @brief    Writes the data payload for a bulk load. Rows are escaped for the dialect and format and written to a buffer
+    ///           that is flushed to the output whenever it fills, so only one buffer of data is held in memory.
+    /// @details  Values of type nullValue are written as NULL. The buffer is flushed when the writer is destroyed.
+
+    class bulkLoadWriter
+    {
+    private:
+      std::ostream *outputStream = nullptr;
+      int fileDescriptor = -1;
+      EDialect dialect;
+      EBulkFormat format;
+      std::size_t columnCount;
+      std::size_t bufferSize;
+      std::string buffer;
+      std::uint64_t rowCount = 0;
+
+      bulkLoadWriter() = delete;
+      bulkLoadWriter(bulkLoadWriter const &) = delete;
+      bulkLoadWriter &operator=(bulkLoadWriter const &) = delete;
+
+      void checkDialect() const;
+      void writeValue(parameter const &);
+      void writeEscaped(std::string_view);
+      void writeQuoted(std::string_view);
+
+    public:
+      bulkLoadWriter(std::ostream &, EDialect, EBulkFormat, std::size_t, std::size_t = 65536);
+      bulkLoadWriter(int, EDialect, EBulkFormat, std::size_t, std::size_t = 65536);
+      ~bulkLoadWriter();
+
+      bulkLoadWriter &writeRow(parameterStorage const &);
+      void flush();
+
+      std::uint64_t rows() const noexcept { return rowCount; }
+    };
+
+    /// @brief    Queries rendered by renderQueries(). Each thread renders a contiguous block of the queries into one buffer. The
+    ///           queries are accessed by index as views into the buffers, in the order of the input.
+
+    class renderedQueries
+    {
+    private:
+      std::size_t blockSize_ = 0;                 ///< Number of queries in each buffer. (The last buffer may be shorter)
+      std::vector<std::string> buffers_;          ///< One buffer per thread, in the order of the queries.
+      std::vector<std::size_t> offsets_;          ///< Offset of each query in its buffer.
+
+      friend class sqlWriter;
+
+    public:
+      std::size_t size() const noexcept { return offsets_.size(); }
+      bool empty() const noexcept { return offsets_.empty(); }
+      std::string_view operator[](std::size_t) const;
+      std::vector<std::string> const &buffers() const noexcept { return buffers_; }
+    };
 
   private:
+    /// @brief    Copy-on-write vector. Copies share the storage until one of them is modified. An empty vector holds no storage.
+    /// @note     Only the read only interface of std::vector is exposed, along with the modifiers used by the writer. Other
+    ///           modifications must use mutate().
+
+    template<typename T>
+    class cowVector
+    {
+    private:
+      using vector_t = std::vector<T>;
+
+      std::shared_ptr<vector_t> data_;
+
+      static vector_t const &emptyVector() { static vector_t const ev; return ev; }
+
+    public:
+      using const_iterator = typename vector_t::const_iterator;
+      using size_type = typename vector_t::size_type;
+
+      vector_t const &get() const noexcept { return data_ ? *data_ : emptyVector(); }
+
+      /// @brief    Returns a modifiable reference to the vector, copying the storage first if it is shared.
+      /// @throws   std::bad_alloc
+
+      vector_t &mutate()
+      {
+        if (!data_)
+        {
+          data_ = std::make_shared<vector_t>();
+        }
+        else if (data_.use_count() > 1)
+        {
+          data_ = std::make_shared<vector_t>(*data_);
+        };
+        return *data_;
+      }
+
+      const_iterator begin() const noexcept { return get().begin(); }
+      const_iterator end() const noexcept { return get().end(); }
+      bool empty() const noexcept { return !data_ || data_->empty(); }
+      bool sharesStorage(cowVector const &other) const noexcept { return data_ && (data_ == other.data_); }
+      size_type size() const noexcept { return data_ ? data_->size() : 0; }
+      T const &operator[](size_type index) const { return get()[index]; }
+      T const &front() const { return get().front(); }
+      T const &back() const { return get().back(); }
+
+      void clear() noexcept { data_.reset(); }
+      void push_back(T const &value) { mutate().push_back(value); }
+      void push_back(T &&value) { mutate().push_back(std::move(value)); }
+      template<typename... Args>
+      T &emplace_back(Args &&... args) { return mutate().emplace_back(std::forward<Args>(args)...); }
+    };
+
     EDialect dialect = MYSQL;
 
-    TDatabaseMap databaseMap;
+    std::shared_ptr<CDatabaseMap const> databaseMap_;
+    bool ownsDatabaseMap_ = true;                 ///< False if the map was supplied by the user. (It may be a const object)
     enum EQueryType
     {
       qt_none,
@@ -155,27 +544,140 @@ namespace GCL
       qt_delete,
       qt_update,
       qt_upsert,
+      qt_updateBatch,
+      qt_bulkLoad,
     };
 
-    std::vector<std::string> selectFields;
-    stringPairStorage fromFields;
-    tripleStorage whereFields;
+    cowVector<identifier> selectFields;
+    cowVector<identifierPair> fromFields;
+    cowVector<parameterTriple> whereFields;
     std::string insertTable;
-    valueStorage valueFields;
-    orderByStorage_t orderByFields;
-    joinStorage joinFields;
+    cowVector<parameterStorage> valueFields;
+    cowVector<orderBy_t> orderByFields;
+    cowVector<identifierJoin> joinFields;
     std::optional<std::uint64_t> offsetValue;
     std::optional<std::uint64_t> limitValue;
     std::optional<std::string> countValue;
     bool distinct_ = false;
-    stringPairStorage minFields;
-    stringPairStorage maxFields;
+    cowVector<stringPair> minFields;
+    cowVector<stringPair> maxFields;
+    cowVector<aggregate_t> aggregateFields;
+    cowVector<std::string> groupByFields;
+    bool groupByRollup = false;
+    cowVector<having_t> havingFields;
+
+      /// Common table expressions are rendered when they are added, in the same way as subqueries.
+
+    struct SCommonTable
+    {
+      std::string name;
+      std::vector<std::string> columns;
+      std::string query;
+      bool recursive = false;
+    };
+
+    struct SWindowFunction
+    {
+      EWindowFunction function;
+      EAggregate aggregate;                       ///< WIN_AGGREGATE only.
+      std::string column;
+      std::vector<std::string> partitionBy;
+      orderByStorage_t orderBy;
+      std::string alias;
+    };
+
+    cowVector<SCommonTable> commonTables;
+    cowVector<SWindowFunction> windowFields;
+
+    struct SIndexHint
+    {
+      std::string tableName;
+      EIndexHint hint;
+      std::vector<std::string> indexes;
+    };
+
+    cowVector<SIndexHint> indexHints;
+    cowVector<std::string> queryHints;
     std::string updateTable;
-    pairStorage setFields;
+    cowVector<parameterPair> setFields;
     std::string deleteTable;
+    std::string batchKey;                         ///< Key column for batched updates.
+    EBulkFormat bulkFormat = BULK_TEXT;
+    std::string bulkFileName;                     ///< File name for LOAD DATA LOCAL INFILE.
+    cowVector<std::string> keysetFields;
+    cowVector<parameter> keysetValues;
+    EOrderBy keysetOrder = ASC;
+
+    enum EPredicate
+    {
+      pt_compare,       ///< column operator value
+      pt_and,           ///< All children
+      pt_or,            ///< Any children
+      pt_not,           ///< Negate a single child
+      pt_in,            ///< column IN (values)
+      pt_notIn,         ///< column NOT IN (values)
+      pt_between,       ///< column BETWEEN value AND value
+      pt_isNull,        ///< column IS NULL
+      pt_isNotNull,     ///< column IS NOT NULL
+      pt_exists,        ///< EXISTS (subquery)
+      pt_inQuery,       ///< column IN (subquery)
+    };
+
+      /// The predicates are stored in a flat arena. Children and values are stored contiguously in predicateChildren and
+      /// predicateValues and are referenced by the first index and count. A predicate only refers to predicates created before
+      /// it.
 
-    EQueryType queryType;
+    struct SPredicate
+    {
+      EPredicate predicateType;
+      std::string columnName;
+      std::string operatorString;                 ///< pt_compare only.
+      std::string subQuery;                       ///< Rendered subquery for pt_exists and pt_inQuery.
+      std::uint32_t first = 0;                    ///< First child or value.
+      std::uint32_t count = 0;                    ///< Number of children or values.
+      std::uint64_t id = 0;                       ///< Unique across all writers. Identifies the predicate to its handles.
+    };
+
+    cowVector<SPredicate> predicateArena;
+    cowVector<std::uint32_t> predicateChildren;
+    cowVector<parameter> predicateValues;
+    cowVector<predicate_t> wherePredicates;       ///< Root predicates joined by AND in the where clause.
+    std::optional<std::size_t> inListLimit;       ///< Maximum number of values in a single IN list.
+
+    EQueryType queryType = qt_none;
+
+      /// Column name resolved against the database map when it was added to the query. The qualifier records how the name was
+      /// qualified so that it can be rendered the same way.
+
+    struct SColumnRef
+    {
+      enum EQualifier
+      {
+        q_none,         ///< Unqualified
+        q_table,        ///< Qualified with the table name.
+        q_alias,        ///< Qualified with a table alias.
+      };
+
+      CDatabaseMap::columnID_t columnID;
+      EQualifier qualifier;
+    };
+    using columnRefStorage_t = cowVector<std::optional<SColumnRef>>;
+
+    bool validateNames_ = false;
+    bool quoteIdentifiers_ = false;
+    columnRefStorage_t selectColumnRefs;          ///< Parallel to selectFields when validating.
+    columnRefStorage_t whereColumnRefs;           ///< Parallel to whereFields when validating.
+    columnRefStorage_t setColumnRefs;             ///< Parallel to setFields when validating.
+    columnRefStorage_t orderByColumnRefs;         ///< Parallel to orderByFields when validating.
+    columnRefStorage_t groupByColumnRefs;         ///< Parallel to groupByFields when validating.
+    columnRefStorage_t aggregateColumnRefs;       ///< Parallel to aggregateFields when validating.
+    columnRefStorage_t havingColumnRefs;          ///< Parallel to havingFields when validating.
+    cowVector<std::optional<CDatabaseMap::tableID_t>> fromTableIDs;   ///< Parallel to fromFields when validating.
+
+    void addColumnRef(columnRefStorage_t &, std::string const &);
+    void resolveSelectColumns();
     std::string currentTable;
+    std::shared_ptr<queryCache> queryCache_;    ///< Optional cache of rendered queries.
 
     bool verifyOperator(std::string const &) const;
 
@@ -197,34 +699,100 @@ namespace GCL
     std::string createFromClause() const;
     std::string createJoinClause() const;
     std::string createWhereClause() const;
+    std::string createGroupByClause() const;
+    std::string createHavingClause() const;
+    std::string aggregateString(EAggregate, std::string const &, columnRefStorage_t const &, std::size_t, std::size_t) const;
+    std::string createWithClause() const;
+    std::string windowString(SWindowFunction const &) const;
+    std::string createHintComment() const;
+    std::string createTableHints(identifierPair const &) const;
+    std::string createOptionClause() const;
     std::string createSetClause() const;
     std::string createLimitClause() const;
+    std::string createKeysetClause() const;
+    char const *aliasKeyword() const noexcept;
+    std::string createMergeQuery() const;
+    std::string createUpdateBatchQuery(std::vector<std::vector<std::string>> const &, std::size_t, std::size_t) const;
+    std::vector<std::vector<std::string>> createBatchValues() const;
+    std::string createBulkLoadQuery() const;
+
+    std::string createQuery() const;
+    std::optional<SColumnRef> resolveColumn(std::string const &) const;
+    std::optional<CDatabaseMap::tableID_t> resolveTable(std::string const &) const;
+    std::string mappedColumn(std::string const &, columnRefStorage_t const &, std::size_t, std::size_t) const;
+    std::string mappedJoinColumn(identifier const &, identifier const &) const;
+    std::string quoteName(std::string_view) const;
+
+    /// @brief    Returns the identifier as it is output. (Quoted if quoting is enabled)
+
+    std::string const &identifierString(identifier const &id) const noexcept
+    {
+      return quoteIdentifiers_ ? id.quoted(dialect) : id.str();
+    }
+    std::string valueString(parameter const &) const;
+
+    CDatabaseMap &mutableDatabaseMap();
+    void createPredicate(std::string &, predicate_t) const;
+    void createInList(std::string &, SPredicate const &) const;
+
+    void checkPredicate(predicate_t) const;
+    predicate_t addPredicate(SPredicate &&);
+    predicate_t addPredicateGroup(EPredicate, std::initializer_list<predicate_t>);
 
   public:
+    sqlWriter() : databaseMap_(std::make_shared<CDatabaseMap>()) {}
+    explicit sqlWriter(std::shared_ptr<CDatabaseMap const> dm) : databaseMap_(std::move(dm)), ownsDatabaseMap_(false) {}
+    virtual ~sqlWriter() = default;
+
+    /// @brief    Returns a copy of the writer that can be extended independently. The storage is shared until it is modified.
+
+    sqlWriter fork() const { return sqlWriter(*this); }
+    std::size_t sharedClauses(sqlWriter const &) const noexcept;
+    std::shared_ptr<CDatabaseMap const> databaseMap() const noexcept { return databaseMap_; }
+
     void setDialect(EDialect d) {dialect = d;}
+    void setQueryCache(std::shared_ptr<queryCache> qc) { queryCache_ = std::move(qc); }
+    void setInListLimit(std::size_t limit) { inListLimit = limit; }
+    void setValidation(bool validate) { validateNames_ = validate; }
+    bool validation() const noexcept { return validateNames_; }
+    void setIdentifierQuoting(bool quote) { quoteIdentifiers_ = quote; }
+    bool identifierQuoting() const noexcept { return quoteIdentifiers_; }
+
+    fingerprint_t fingerprint() const;
 
     void resetQuery();
     void resetWhere();
 
+    sqlWriter &aggregate(EAggregate, std::string const &, std::string const & = "");
+    sqlWriter &avg(std::string const &, std::string const & = "");
+    sqlWriter &bulkLoad(std::string const &, std::initializer_list<std::string>, EBulkFormat = BULK_TEXT, std::string const & = "");
     sqlWriter &count(std::string const &);
     sqlWriter &deleteFrom(std::string const &);
     sqlWriter &distinct();
     sqlWriter &from(std::string const &, std::string const & = "");
     sqlWriter &from(std::initializer_list<std::string>);
+    sqlWriter &groupBy(std::initializer_list<std::string>, bool = false);
+    sqlWriter &indexHint(std::string const &, EIndexHint, std::initializer_list<std::string>);
+    sqlWriter &having(EAggregate, std::string const &, std::string const &, parameter const &);
+    sqlWriter &having(std::string const &, std::string const &, parameter const &);
     sqlWriter &insertInto(std::string, std::initializer_list<std::string>);
     sqlWriter &insertInto(std::string);
     sqlWriter &join(std::initializer_list<parameterJoin>);
+    sqlWriter &keyset(std::initializer_list<std::string>, parameterStorage const &, std::uint64_t, EOrderBy = ASC);
     sqlWriter &limit(std::uint64_t);
     sqlWriter &max(std::string const &, std::string const & = "");
     sqlWriter &min(std::string const &, std::string const & = "");
     sqlWriter &offset(std::uint64_t);
     sqlWriter &orderBy(std::initializer_list<std::pair<std::string, EOrderBy>>);
+    sqlWriter &queryHint(std::string const &);
     sqlWriter &select();
     sqlWriter &select(std::initializer_list<std::string>);
     sqlWriter &select(std::string const &, std::initializer_list<std::string>);
     sqlWriter &set(std::string const &, parameter const &);
     sqlWriter &set(std::initializer_list<parameterPair>);
+    sqlWriter &sum(std::string const &, std::string const & = "");
     sqlWriter &update(std::string const &);
+    sqlWriter &updateBatch(std::string const &, std::string const &, std::initializer_list<std::string>);
     sqlWriter &upsert(std::string const &);
 
     /// @brief Adds a single where clause to the where list.
@@ -232,22 +800,49 @@ namespace GCL
     /// @param[in] operatorString: The operatorString to add
     /// @param[in] value: The value to add.
     /// @returns (*this)
-    /// @throws None.
+    /// @throws GCL::runtime_error (If validation is enabled)
+    /// @version 2026-10-18/GGB - Validate the column name.
     /// @version 2020-09-09/GGB - Changed to a templated forwarding reference.
     /// @version 2017-08-21/GGB - Function created.
 
     template<typename T>
     sqlWriter &where(std::string const &columnName, std::string const &operatorString, T &&value)
     {
+      addColumnRef(whereColumnRefs, columnName);
       whereFields.emplace_back(columnName, operatorString, std::forward<T>(value));
 
       return (*this);
     }
 
     sqlWriter &where(std::initializer_list<parameterTriple>);
+    sqlWriter &where(predicate_t);
+
+    predicate_t predicateAnd(std::initializer_list<predicate_t>);
+    predicate_t predicateOr(std::initializer_list<predicate_t>);
+    predicate_t predicateNot(predicate_t);
+    predicate_t predicateCompare(std::string const &, std::string const &, parameter const &);
+    predicate_t predicateIn(std::string const &, parameterStorage);
+    predicate_t predicateIn(std::string const &, sqlWriter const &);
+    predicate_t predicateNotIn(std::string const &, parameterStorage);
+    predicate_t predicateBetween(std::string const &, parameter const &, parameter const &);
+    predicate_t predicateIsNull(std::string const &);
+    predicate_t predicateIsNotNull(std::string const &);
+    predicate_t predicateExists(sqlWriter const &);
     sqlWriter &values(std::initializer_list<parameterStorage>);
+    sqlWriter &window(EWindowFunction, std::string const &, std::initializer_list<std::string>, std::initializer_list<orderBy_t>,
+                      std::string const & = "");
+    sqlWriter &window(EAggregate, std::string const &, std::initializer_list<std::string>, std::initializer_list<orderBy_t>,
+                      std::string const & = "");
+    sqlWriter &with(std::string const &, sqlWriter const &, std::initializer_list<std::string> = {});
+    sqlWriter &withRecursive(std::string const &, sqlWriter const &, sqlWriter const &, std::initializer_list<std::string> = {});
 
     std::string string() const;
+    std::vector<std::string> strings(std::size_t) const;
+
+    static renderedQueries renderQueries(std::vector<sqlWriter> const &, std::size_t = 0);
+    static void renderQueries(std::vector<sqlWriter> const &, std::ostream &, std::size_t = 0, std::string const & = ";\n");
+    bulkLoadWriter bulkWriter(std::ostream &) const;
+    bulkLoadWriter bulkWriter(int) const;
 
     virtual void readMapFile(boost::filesystem::path const &);
 
@@ -256,6 +851,7 @@ namespace GCL
   };
 
   std::string to_string(GCL::sqlWriter::bindValue const &);
+  std::string to_string(GCL::sqlWriter::nullValue const &);
 
 }  // namespace GCL
 
@@ -267,6 +863,13 @@ namespace SCL
     auto ptr = static_cast<GCL::sqlWriter::bindValue const *>(anyp->dataStorage.heapPointer);
     return GCL::to_string(*ptr);
   }
+
+  template<>
+  inline std::string any::Manager_external<GCL::sqlWriter::nullValue>::S_toString(any const *anyp)
+  {
+    auto ptr = static_cast<GCL::sqlWriter::nullValue const *>(anyp->dataStorage.heapPointer);
+    return GCL::to_string(*ptr);
+  }
 }
 
 
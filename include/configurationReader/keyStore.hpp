@@ -0,0 +1,799 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                configurationReader/keyStore.hpp
+// SUBSYSTEM:           Configuratoin file reader
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Flat storage of the section, tag and value strings of a configuration file.
+//
+// CLASSES INCLUDED:    CKeyStore
+//
+// HISTORY:             2026-10-18 GGB - Added source locations.
+//                      2026-10-18 GGB - Added saving to, and opening from, binary cache files.
+//                      2026-10-18 GGB - Added the cache of converted values.
+//                      2026-10-18 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_KEYSTORE_HPP
+#define GCL_KEYSTORE_HPP
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+  // Miscellaneous library header files
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace GCL
+{
+  /// @details  Stores (section, tag) -> value triplets for the configuration readers. All the text is stored in a single string and
+  ///           the entries only hold offsets into the text. The entries are indexed by an open addressing (linear probing) hash
+  ///           table of the precomputed (section, tag) hashes. Lookups take std::string_view values and do not allocate.
+  ///           The views returned by find() are valid until the next call to insert() or clear().
+  ///           If a (section, tag) pair is inserted more than once, the first value is kept. assign() replaces the value.
+  ///           The size of the text is limited to 4GB.
+  ///           findConverted() caches the result of converting a value, one slot for each type of conversion. Later calls for the
+  ///           same entry and conversion return the cached value without converting the text again. The cache slots are atomic
+  ///           so that concurrent readers may fill them.
+  ///           saveCache() writes the store to a binary file. (A header, the entries, the hash table and the text) openCache()
+  ///           memory maps the file and uses it directly, without parsing or copying. The header holds a format version and a key
+  ///           supplied by the caller that identifies the source of the values. If either does not match, or the file is not
+  ///           valid, the cache is not used. Cache files are only portable between machines with the same byte order.
+  ///           The file and line of each value can be stored for diagnostics. (See location()) Source locations are not saved in
+  ///           cache files.
+
+  class CKeyStore : public std::enable_shared_from_this<CKeyStore>
+  {
+  public:
+    using hash_t = std::uint64_t;
+
+    enum EConversion : std::uint8_t
+    {
+      CONVERT_DOUBLE,
+      CONVERT_UINT16,
+      CONVERT_INT32,
+      CONVERT_INT64,
+      CONVERT_UINT64,
+      CONVERT_BOOL,
+      CONVERT_DURATION,
+      CONVERT_BYTESIZE,
+      CONVERT_COUNT
+    };
+
+    struct SSourceLocation
+    {
+      std::string_view file;                    ///< The name of the file.
+      std::uint32_t line;                       ///< The line number. (1 based, 0 if not from a file)
+    };
+
+  private:
+    struct SEntry
+    {
+      hash_t hash;
+      std::uint32_t sectionOffset;
+      std::uint32_t sectionLength;
+      std::uint32_t tagOffset;
+      std::uint32_t tagLength;
+      std::uint32_t valueOffset;
+      std::uint32_t valueLength;
+    };
+
+    static_assert(sizeof(SEntry) == 32, "SEntry is stored in cache files and must not change size.");
+
+      /// Header of a binary cache file. The entries, hash table slots and text follow the header.
+
+    struct SCacheHeader
+    {
+      char magic[8];
+      std::uint32_t version;
+      std::uint32_t byteOrder;
+      std::uint32_t entrySize;
+      std::uint32_t reserved;
+      std::uint64_t sourceKey;
+      std::uint64_t entryCount;
+      std::uint64_t slotCount;
+      std::uint64_t textSize;
+      std::uint64_t headerHash;
+    };
+
+    static constexpr char cacheMagic[8] = {'G', 'C', 'L', 'K', 'E', 'Y', 'S', '\0'};
+    static constexpr std::uint32_t cacheVersion = 1;
+    static constexpr std::uint32_t cacheByteOrder = 0x01020304;
+
+    std::string text_;                          ///< The section, tag and value text.
+    std::vector<SEntry> entries_;               ///< The entries in order of insertion.
+    std::vector<std::uint32_t> slots_;          ///< Hash table. Entry index + 1, 0 = empty slot. Size is a power of 2.
+
+    struct SLocation
+    {
+      std::uint32_t file;                       ///< Index into files_ + 1. 0 = no location.
+      std::uint32_t line;
+    };
+
+    std::vector<std::string> files_;            ///< The names of the source files.
+    std::vector<SLocation> locations_;          ///< Source location of each entry. May be shorter than entries_.
+
+      // The data used for lookups. Either the members above, or a memory mapped cache file.
+
+    std::string_view textData_;                 ///< The text.
+    SEntry const *entryData_ = nullptr;         ///< The entries.
+    std::size_t entryCount_ = 0;                ///< Number of entries.
+    std::uint32_t const *slotData_ = nullptr;   ///< The hash table.
+    std::size_t slotCount_ = 0;                 ///< Number of slots in the hash table.
+    std::unique_ptr<boost::interprocess::mapped_region> mappedRegion_;  ///< The mapped cache file. (If opened from a cache)
+
+      /// Converted values of an entry. A value is only valid if its bit is set in validMask.
+
+    struct SConversionCache
+    {
+      std::atomic<std::uint8_t> validMask{0};
+      std::atomic<std::uint64_t> values[CONVERT_COUNT];
+    };
+
+    static_assert(CONVERT_COUNT <= 8, "validMask must have a bit for each conversion.");
+
+    mutable std::deque<SConversionCache> cache_;  ///< Converted values. One for each entry.
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// @brief      Points the lookup data at the owned text, entries and hash table.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void updateViews() noexcept
+    {
+      textData_ = text_;
+      entryData_ = entries_.data();
+      entryCount_ = entries_.size();
+      slotData_ = slots_.data();
+      slotCount_ = slots_.size();
+    }
+
+    /// @brief      Returns the FNV-1a hash of a cache file header, excluding the headerHash field.
+    /// @param[in]  header: The header.
+    /// @returns    The hash value.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    static hash_t headerHash(SCacheHeader const &header) noexcept
+    {
+      return hash(std::string_view(reinterpret_cast<char const *>(&header), offsetof(SCacheHeader, headerHash)),
+                  std::string_view());
+    }
+
+    /// @brief      Finds the index of an entry.
+    /// @param[in]  keyHash: The value of hash(section, tagName).
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @returns    The index of the entry, or npos if not found.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::size_t findEntry(hash_t keyHash, std::string_view section, std::string_view tagName) const noexcept
+    {
+      std::size_t returnValue = npos;
+
+      if (slotCount_ != 0)
+      {
+        std::size_t slot = keyHash & (slotCount_ - 1);
+
+        while (slotData_[slot] != 0)
+        {
+          SEntry const &entry = entryData_[slotData_[slot] - 1];
+
+          if ( (entry.hash == keyHash) && (textView(entry.tagOffset, entry.tagLength) == tagName) &&
+               (textView(entry.sectionOffset, entry.sectionLength) == section) )
+          {
+            returnValue = slotData_[slot] - 1;
+            break;
+          };
+
+          slot = (slot + 1) & (slotCount_ - 1);
+        };
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Returns a view of a string in the text.
+    /// @param[in]  offset: The offset of the string.
+    /// @param[in]  length: The length of the string.
+    /// @returns    The view of the string.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::string_view textView(std::uint32_t offset, std::uint32_t length) const noexcept
+    {
+      return textData_.substr(offset, length);
+    }
+
+    /// @brief      Appends a string to the text.
+    /// @param[in]  value: The string to append.
+    /// @returns    The offset of the string.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::uint32_t appendText(std::string_view value)
+    {
+      std::uint32_t returnValue = static_cast<std::uint32_t>(text_.size());
+
+      text_.append(value);
+      return returnValue;
+    }
+
+    /// @brief      Rebuilds the hash table with the specified number of slots.
+    /// @param[in]  slotCount: The number of slots. Must be a power of 2.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    void rehash(std::size_t slotCount)
+    {
+      slots_.assign(slotCount, 0);
+
+      for (std::size_t index = 0; index < entries_.size(); ++index)
+      {
+        std::size_t slot = entries_[index].hash & (slotCount - 1);
+
+        while (slots_[slot] != 0)
+        {
+          slot = (slot + 1) & (slotCount - 1);
+        };
+
+        slots_[slot] = static_cast<std::uint32_t>(index + 1);
+      };
+
+      updateViews();
+    }
+
+  public:
+    /// @brief      Returns the hash of a (section, tag) pair. (FNV-1a) The hash does not depend on the platform.
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @returns    The hash value.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    static constexpr hash_t hash(std::string_view section, std::string_view tagName) noexcept
+    {
+      hash_t returnValue = 14695981039346656037ULL;
+
+      for (char c : section)
+      {
+        returnValue = (returnValue ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+      };
+
+        // Seperate the section and tag so that ("ab", "c") and ("a", "bc") are different.
+
+      returnValue = (returnValue ^ 0xFF) * 1099511628211ULL;
+
+      for (char c : tagName)
+      {
+        returnValue = (returnValue ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Reserves space for the entries and text.
+    /// @param[in]  entryCount: The expected number of entries.
+    /// @param[in]  textSize: The expected size of the text.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    void reserve(std::size_t entryCount, std::size_t textSize)
+    {
+      std::size_t slotCount = 16;
+
+      while (slotCount < entryCount * 2)
+      {
+        slotCount *= 2;
+      };
+
+      entries_.reserve(entryCount);
+      text_.reserve(textSize);
+
+      if (slotCount > slots_.size())
+      {
+        rehash(slotCount);
+      };
+
+      updateViews();
+    }
+
+  private:
+    /// @brief      Stores the source location of an entry.
+    /// @param[in]  index: The index of the entry.
+    /// @param[in]  file: The name of the file the value was read from. Empty if the location is not stored.
+    /// @param[in]  line: The line the value was read from.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created. (From insert())
+
+    void setLocation(std::size_t index, std::string_view file, std::uint32_t line)
+    {
+      if (!file.empty())
+      {
+        std::size_t fileIndex = files_.size();
+
+          // Values are normally inserted a file at a time, so check the last file first.
+
+        if (files_.empty() || (files_.back() != file))
+        {
+          fileIndex = static_cast<std::size_t>(std::find(files_.begin(), files_.end(), file) - files_.begin());
+
+          if (fileIndex == files_.size())
+          {
+            files_.emplace_back(file);
+          };
+        }
+        else
+        {
+          fileIndex = files_.size() - 1;
+        };
+
+        if (locations_.size() <= index)
+        {
+          locations_.resize(index + 1, SLocation{0, 0});
+        };
+        locations_[index] = SLocation{static_cast<std::uint32_t>(fileIndex + 1), line};
+      }
+      else if (index < locations_.size())
+      {
+        locations_[index] = SLocation{0, 0};
+      };
+    }
+
+  public:
+    /// @brief      Inserts a value. If the (section, tag) pair already exists, the existing value is kept.
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @param[in]  value: The value.
+    /// @param[in]  file: The name of the file the value was read from. Empty if the location is not stored.
+    /// @param[in]  line: The line the value was read from.
+    /// @returns    true if the value was inserted. false if the pair already existed.
+    /// @throws     std::bad_alloc
+    /// @note       Stores opened from a cache file are const and can not be inserted into.
+    /// @version    2026-10-18/GGB - Added file and line.
+    /// @version    2026-10-18/GGB - Function created.
+
+    bool insert(std::string_view section, std::string_view tagName, std::string_view value, std::string_view file = {},
+                std::uint32_t line = 0)
+    {
+      bool returnValue = false;
+      hash_t keyHash = hash(section, tagName);
+
+      if (findEntry(keyHash, section, tagName) == npos)
+      {
+        SEntry entry;
+
+          // Keep the load factor at or below 0.5
+
+        if ((entries_.size() + 1) * 2 > slots_.size())
+        {
+          rehash(slots_.empty() ? 16 : slots_.size() * 2);
+        };
+
+          // Entries are normally inserted a section at a time, so share the section text with the previous entry.
+
+        if (!entries_.empty() && textView(entries_.back().sectionOffset, entries_.back().sectionLength) == section)
+        {
+          entry.sectionOffset = entries_.back().sectionOffset;
+        }
+        else
+        {
+          entry.sectionOffset = appendText(section);
+        };
+
+        entry.hash = keyHash;
+        entry.sectionLength = static_cast<std::uint32_t>(section.size());
+        entry.tagLength = static_cast<std::uint32_t>(tagName.size());
+        entry.tagOffset = appendText(tagName);
+        entry.valueLength = static_cast<std::uint32_t>(value.size());
+        entry.valueOffset = appendText(value);
+
+        entries_.push_back(entry);
+        cache_.emplace_back();
+
+        setLocation(entries_.size() - 1, file, line);
+
+        std::size_t slot = keyHash & (slots_.size() - 1);
+
+        while (slots_[slot] != 0)
+        {
+          slot = (slot + 1) & (slots_.size() - 1);
+        };
+        slots_[slot] = static_cast<std::uint32_t>(entries_.size());
+
+        updateViews();
+        returnValue = true;
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Stores a value, replacing the value of the (section, tag) pair if it already exists.
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @param[in]  value: The value.
+    /// @param[in]  file: The name of the file the value was read from. Empty if the location is not stored.
+    /// @param[in]  line: The line the value was read from.
+    /// @returns    true if the value was inserted. false if an existing value was replaced.
+    /// @throws     std::bad_alloc
+    /// @note       The text of a replaced value is not reclaimed. Only call while the store is being built, before it is
+    ///             shared with readers.
+    /// @version    2026-10-18/GGB - Function created.
+
+    bool assign(std::string_view section, std::string_view tagName, std::string_view value, std::string_view file = {},
+                std::uint32_t line = 0)
+    {
+      bool returnValue = false;
+      std::size_t index = findEntry(hash(section, tagName), section, tagName);
+
+      if (index == npos)
+      {
+        returnValue = insert(section, tagName, value, file, line);
+      }
+      else
+      {
+        entries_[index].valueLength = static_cast<std::uint32_t>(value.size());
+        entries_[index].valueOffset = appendText(value);
+        cache_[index].validMask.store(0, std::memory_order_relaxed);
+        setLocation(index, file, line);
+        updateViews();
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Finds a value using a precomputed hash.
+    /// @param[in]  keyHash: The value of hash(section, tagName).
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @returns    A view of the value if found.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::optional<std::string_view> find(hash_t keyHash, std::string_view section, std::string_view tagName) const noexcept
+    {
+      std::optional<std::string_view> returnValue;
+      std::size_t index = findEntry(keyHash, section, tagName);
+
+      if (index != npos)
+      {
+        returnValue = textView(entryData_[index].valueOffset, entryData_[index].valueLength);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Finds a value.
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @returns    A view of the value if found.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::optional<std::string_view> find(std::string_view section, std::string_view tagName) const noexcept
+    {
+      return find(hash(section, tagName), section, tagName);
+    }
+
+    /// @brief      Returns the source location of a value.
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @returns    The location, if the value was found and its location was stored.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::optional<SSourceLocation> location(std::string_view section, std::string_view tagName) const noexcept
+    {
+      std::optional<SSourceLocation> returnValue;
+      std::size_t index = findEntry(hash(section, tagName), section, tagName);
+
+      if ((index < locations_.size()) && (locations_[index].file != 0))
+      {
+        returnValue = SSourceLocation{files_[locations_[index].file - 1], locations_[index].line};
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Finds a value and converts it. The result of the conversion is cached, so the text is only converted once.
+    /// @tparam     T: The type of the converted value. Must be an arithmetic type.
+    /// @param[in]  section: The section name.
+    /// @param[in]  tagName: The tag name.
+    /// @param[in]  conversion: The cache slot to use. Each slot must only be used with one type and conversion function.
+    /// @param[in]  convert: Called as convert(std::string_view) to convert the value if it is not cached.
+    /// @returns    The converted value if found.
+    /// @throws     Any exception thrown by convert. Values that fail to convert are not cached.
+    /// @version    2026-10-18/GGB - Function created.
+
+    template<typename T, typename F>
+    std::optional<T> findConverted(std::string_view section, std::string_view tagName, EConversion conversion, F &&convert) const
+    {
+      static_assert(std::is_arithmetic_v<T> && (sizeof(T) <= sizeof(std::uint64_t)), "T can not be cached.");
+
+      std::optional<T> returnValue;
+      std::size_t index = findEntry(hash(section, tagName), section, tagName);
+
+      if (index != npos)
+      {
+        SConversionCache &cache = cache_[index];
+        std::uint8_t const flag = static_cast<std::uint8_t>(1U << conversion);
+        std::uint64_t bits = 0;
+        T value;
+
+        if (cache.validMask.load(std::memory_order_acquire) & flag)
+        {
+          bits = cache.values[conversion].load(std::memory_order_relaxed);
+          std::memcpy(&value, &bits, sizeof(T));
+        }
+        else
+        {
+          value = convert(textView(entryData_[index].valueOffset, entryData_[index].valueLength));
+          std::memcpy(&bits, &value, sizeof(T));
+          cache.values[conversion].store(bits, std::memory_order_relaxed);
+          cache.validMask.fetch_or(flag, std::memory_order_release);
+        };
+
+        returnValue = value;
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Calls a function for each entry in order of insertion.
+    /// @param[in]  function: Called as function(section, tagName, value).
+    /// @throws     Any exception thrown by function.
+    /// @version    2026-10-18/GGB - Function created.
+
+    template<typename F>
+    void forEach(F &&function) const
+    {
+      for (SEntry const *entry = entryData_; entry != entryData_ + entryCount_; ++entry)
+      {
+        function(textView(entry->sectionOffset, entry->sectionLength), textView(entry->tagOffset, entry->tagLength),
+                 textView(entry->valueOffset, entry->valueLength));
+      };
+    }
+
+    /// @brief      Returns the number of entries.
+    /// @returns    The number of entries.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::size_t size() const noexcept
+    {
+      return entryCount_;
+    }
+
+    /// @brief      Returns true if there are no entries.
+    /// @returns    true if empty.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    bool empty() const noexcept
+    {
+      return (entryCount_ == 0);
+    }
+
+    /// @brief      Removes all the entries.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void clear() noexcept
+    {
+      text_.clear();
+      entries_.clear();
+      slots_.clear();
+      cache_.clear();
+      files_.clear();
+      locations_.clear();
+      mappedRegion_.reset();
+      updateViews();
+    }
+
+    /// @brief      Releases unused memory after loading.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    void shrink_to_fit()
+    {
+      text_.shrink_to_fit();
+      entries_.shrink_to_fit();
+      locations_.shrink_to_fit();
+      updateViews();
+    }
+
+    /// @brief      Writes the store to a binary cache file. The file is written to a temporary file and then renamed, so other
+    ///             processes never see a partly written cache.
+    /// @param[in]  cachePath: The path of the cache file.
+    /// @param[in]  sourceKey: Identifies the source of the values. (eg a hash of the size, modification time and contents of the file)
+    /// @returns    true if the cache was written.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    bool saveCache(std::filesystem::path const &cachePath, std::uint64_t sourceKey) const noexcept
+    {
+      bool returnValue = false;
+      std::filesystem::path tempPath = cachePath;
+      std::error_code ec;
+
+      try
+      {
+        SCacheHeader header;
+
+        tempPath += ".tmp" + std::to_string(std::random_device()());
+
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, cacheMagic, sizeof(header.magic));
+        header.version = cacheVersion;
+        header.byteOrder = cacheByteOrder;
+        header.entrySize = sizeof(SEntry);
+        header.sourceKey = sourceKey;
+        header.entryCount = entryCount_;
+        header.slotCount = slotCount_;
+        header.textSize = textData_.size();
+        header.headerHash = headerHash(header);
+
+        {
+          std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+
+          ofs.write(reinterpret_cast<char const *>(&header), sizeof(header));
+          ofs.write(reinterpret_cast<char const *>(entryData_), static_cast<std::streamsize>(entryCount_ * sizeof(SEntry)));
+          ofs.write(reinterpret_cast<char const *>(slotData_), static_cast<std::streamsize>(slotCount_ * sizeof(std::uint32_t)));
+          ofs.write(textData_.data(), static_cast<std::streamsize>(textData_.size()));
+          ofs.close();
+
+          returnValue = !ofs.fail();
+        }
+
+        if (returnValue)
+        {
+          std::filesystem::rename(tempPath, cachePath, ec);
+          returnValue = !ec;
+        };
+      }
+      catch(std::exception const &)
+      {
+        returnValue = false;
+      };
+
+      if (!returnValue)
+      {
+        std::filesystem::remove(tempPath, ec);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Opens a binary cache file written by saveCache(). The file is memory mapped and used directly.
+    /// @param[in]  cachePath: The path of the cache file.
+    /// @param[in]  sourceKey: Must match the key the cache was saved with.
+    /// @returns    The store, or nullptr if the file does not exist, is not valid, or was saved with a different key or version.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    static std::unique_ptr<CKeyStore const> openCache(std::filesystem::path const &cachePath, std::uint64_t sourceKey)
+    {
+      std::unique_ptr<CKeyStore> returnValue;
+      std::unique_ptr<boost::interprocess::mapped_region> mappedRegion;
+      std::error_code ec;
+
+      if (std::filesystem::file_size(cachePath, ec) >= sizeof(SCacheHeader) && !ec)
+      {
+        try
+        {
+          boost::interprocess::file_mapping mapFile(cachePath.c_str(), boost::interprocess::read_only);
+
+          mappedRegion = std::make_unique<boost::interprocess::mapped_region>(mapFile, boost::interprocess::read_only);
+        }
+        catch(std::exception const &)
+        {
+          mappedRegion.reset();
+        };
+      };
+
+      if (mappedRegion && (mappedRegion->get_size() >= sizeof(SCacheHeader)))
+      {
+        char const *data = static_cast<char const *>(mappedRegion->get_address());
+        std::uint64_t fileSize = mappedRegion->get_size();
+        SCacheHeader header;
+
+        std::memcpy(&header, data, sizeof(header));
+
+          // Check the header, then that the sizes agree with the file, then that every offset is inside the file, so that lookups
+          // can not read outside the mapping.
+
+        bool valid = (std::memcmp(header.magic, cacheMagic, sizeof(header.magic)) == 0) && (header.version == cacheVersion) &&
+                     (header.byteOrder == cacheByteOrder) && (header.entrySize == sizeof(SEntry)) &&
+                     (header.headerHash == headerHash(header)) && (header.sourceKey == sourceKey) &&
+                     (header.entryCount < header.slotCount || header.entryCount == 0) &&
+                     ((header.slotCount & (header.slotCount - 1)) == 0) &&
+                     (header.slotCount <= fileSize / sizeof(std::uint32_t)) && (header.entryCount <= fileSize / sizeof(SEntry)) &&
+                     (sizeof(SCacheHeader) + header.entryCount * sizeof(SEntry) + header.slotCount * sizeof(std::uint32_t) +
+                      header.textSize == fileSize);
+
+        if (valid)
+        {
+          SEntry const *entries = reinterpret_cast<SEntry const *>(data + sizeof(SCacheHeader));
+          std::uint32_t const *slots = reinterpret_cast<std::uint32_t const *>(entries + header.entryCount);
+          std::uint64_t emptySlots = 0;
+
+          for (std::uint64_t index = 0; valid && (index < header.entryCount); ++index)
+          {
+            valid = (std::uint64_t(entries[index].sectionOffset) + entries[index].sectionLength <= header.textSize) &&
+                    (std::uint64_t(entries[index].tagOffset) + entries[index].tagLength <= header.textSize) &&
+                    (std::uint64_t(entries[index].valueOffset) + entries[index].valueLength <= header.textSize);
+          };
+
+          for (std::uint64_t index = 0; valid && (index < header.slotCount); ++index)
+          {
+            valid = (slots[index] <= header.entryCount);
+            emptySlots += (slots[index] == 0) ? 1 : 0;
+          };
+
+            // Probing stops at an empty slot, so there must be at least one.
+
+          if (valid && ((header.slotCount == 0) || (emptySlots != 0)))
+          {
+            returnValue = std::make_unique<CKeyStore>();
+            returnValue->textData_ = std::string_view(reinterpret_cast<char const *>(slots + header.slotCount),
+                                                      static_cast<std::size_t>(header.textSize));
+            returnValue->entryData_ = entries;
+            returnValue->entryCount_ = static_cast<std::size_t>(header.entryCount);
+            returnValue->slotData_ = slots;
+            returnValue->slotCount_ = static_cast<std::size_t>(header.slotCount);
+            returnValue->mappedRegion_ = std::move(mappedRegion);
+
+            for (std::size_t index = 0; index < returnValue->entryCount_; ++index)
+            {
+              returnValue->cache_.emplace_back();
+            };
+          };
+        };
+      };
+
+      return returnValue;
+    }
+  };  // class CKeyStore
+
+} // namespace GCL
+
+#endif // GCL_KEYSTORE_HPP
@@ -27,7 +27,15 @@
 //
 // CLASSES INCLUDED:
 //
-// HISTORY:             2020-04-27 GGB - File Created
+// HISTORY:             2026-10-18 GGB - Layers changed after the file is loaded are applied immediately.
+//                      2026-10-18 GGB - Lock-free lookups. Old snapshots are freed once no lookup uses them.
+//                      2026-10-18 GGB - Old snapshots are released when they are no longer used.
+//                      2026-10-18 GGB - Added include and include_dir directives and source locations.
+//                      2026-10-18 GGB - Added default, environment and command line layers.
+//                      2026-10-18 GGB - Added the binary cache file.
+//                      2026-10-18 GGB - Parsing, snapshots, reloading and watching moved from CReaderSections.
+//                      2026-10-18 GGB - Conversions use std::from_chars. Added bool, int64, uint64, duration, byte size and list values.
+//                      2020-04-27 GGB - File Created
 //
 //*********************************************************************************************************************************
 
@@ -36,70 +44,1330 @@
 
   // Standard C++ library header files
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
 #include <cstdint>
 #include <exception>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#else
+#include <condition_variable>
+#endif
+
+#if defined(_WIN32)
+#include <stdlib.h>
+#else
+#include <unistd.h>
+
+extern char **environ;
+#endif
 
   // Miscellaneous library header files
 
-#include <boost/algorithm/string.hpp>
-#include <boost/lexical_cast.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/locale.hpp>
 
   // GCL library header files.
 
+#include "include/error.h"
+#include "include/configurationReader/keyStore.hpp"
 #include "include/logger/loggerCore.h"
 
-namespace GCL
-{
-  using GCL::logger::DEBUGMESSAGE;
+namespace GCL
+{
+  using GCL::logger::DEBUGMESSAGE;
+
+  /// @details  Base class of the configuration file readers. The file is memory mapped and parsed in a single pass into an
+  ///           immutable snapshot (CKeyStore) that all lookups are served from. The same parser is used by all the readers.
+  ///           Files with sections are parsed if sectionOpenChar_ is not empty, otherwise all tags are stored in the section "".
+  ///           The file is loaded on the first lookup, or by loadFile(). Once loaded, lookups are not blocked by reloads and a
+  ///           reader can be shared between threads.
+  ///           reload() parses the file into a new snapshot and publishes it with an atomic pointer swap. startWatching() starts
+  ///           a background thread that reloads the file when it changes. (inotify on Linux, otherwise the modification time is
+  ///           polled.) Old snapshots are freed by the reload once the lookups that started before it have finished. Lookups only
+  ///           increment and decrement a counter (see CSnapshotGuard), so they are lock-free. tagValueView() returns a view that
+  ///           keeps its snapshot alive, so it stays valid after reloads.
+  ///           Change callbacks are called after a new snapshot is published, for each tag that was added, changed or removed.
+  ///           Converted values are cached for each tag and type, so repeated reads of the same value are a single lookup.
+  ///           Binary cache - If binaryCache_ is true, the parsed values are written to a binary file next to the configuration
+  ///           file. (filename + ".cache") Later loads memory map the cache instead of parsing the file, if the size, modification
+  ///           time, first and last 4kB of the file and the parser settings are unchanged. See CKeyStore::openCache().
+  ///           Layers - Values can be overridden by layers that are merged with the file into the snapshot when the file is
+  ///           loaded, so lookups are still a single probe. From lowest to highest priority the layers are: defaults
+  ///           (setDefault()), the file, environment variables (setEnvironmentPrefix()) and the command line (setCommandLine()).
+  ///           The values from the file are kept, so changing a layer after the file is loaded merges them again and publishes a
+  ///           new snapshot without reading the file. The binary cache only holds the values from the file.
+  ///           Includes - A line "include path" includes another file and a line "include_dir path" includes all the files in a
+  ///           directory that have the same extension as the including file, in order of filename. Relative paths are relative
+  ///           to the directory of the including file. Included files start in the section "" and the values are merged in the
+  ///           order they are included. A value from a file that is merged later overrides the value from an earlier file, so a
+  ///           file can include its base settings first and then override them. Within a file the first value of a tag is
+  ///           used. A file that is included more than once is only merged the first time it is included, so a shared base
+  ///           file does not undo overrides made after it. The files are parsed in parallel. Files that include each other are
+  ///           an error.
+  ///           The file and line of each value is stored, see tagLocation(), and is added to conversion error messages.
+  ///           Files that include other files are not written to the binary cache, and only the main file is watched.
+
+  class CReaderCore
+  {
+  public:
+    using changeCallback_t = std::function<void(std::string_view section, std::string_view tagName,
+                                                std::optional<std::string_view> value)>;
+
+      /// Where the value of a tag came from. See tagLocation().
+
+    struct STagLocation
+    {
+      std::string file;                         ///< The name of the file, or the layer.
+      std::uint32_t line;                       ///< The line number. (1 based, 0 if not from a file)
+    };
+
+    /// @brief  A view of a tag value that keeps the snapshot holding the value alive, so the view stays valid after reloads.
+
+    class CValueView
+    {
+    private:
+      std::shared_ptr<CKeyStore const> keyStore_;
+      std::string_view value_;
+
+    public:
+      CValueView(std::shared_ptr<CKeyStore const> keyStore, std::string_view value) noexcept
+        : keyStore_(std::move(keyStore)), value_(value) {}
+
+      std::string_view value() const noexcept { return value_; }
+      operator std::string_view() const noexcept { return value_; }
+
+      friend bool operator==(CValueView const &lhs, std::string_view rhs) noexcept { return lhs.value_ == rhs; }
+      friend bool operator!=(CValueView const &lhs, std::string_view rhs) noexcept { return lhs.value_ != rhs; }
+    };
+
+  private:
+    CReaderCore() = delete;
+    CReaderCore(CReaderCore const &) = delete;
+    CReaderCore(CReaderCore &&) = delete;
+    CReaderCore &operator =(CReaderCore const &) = delete;
+
+    struct SChangeCallback
+    {
+      std::size_t callbackID;
+      std::string section;
+      std::string tagName;
+      changeCallback_t callback;
+    };
+
+    struct SLayerValue
+    {
+      std::string section;
+      std::string tagName;
+      std::string value;
+    };
+
+    struct SParsedValue
+    {
+      std::string_view section;
+      std::string_view tagName;
+      std::string_view value;
+      std::uint32_t line;
+      std::size_t include;                      ///< Index into SParsedFile::includes for include lines. npos for values.
+    };
+
+    struct SParsedFile
+    {
+      std::string name;                         ///< The name of the file used in source locations.
+      boost::interprocess::mapped_region mapRegion;
+      std::vector<SParsedValue> values;         ///< The values and include lines in order.
+      std::vector<std::vector<std::filesystem::path>> includes; ///< The files included by each include line. (Canonical paths)
+    };
+
+    static constexpr std::size_t readerStripes = 16;
+
+      /// Number of lookups in progress. Padded so that threads counting in different stripes do not share a cache line.
+
+    struct alignas(64) SReaderCount
+    {
+      std::atomic<std::uint32_t> count{0};
+    };
+
+    std::atomic<CKeyStore const *> snapshot_{nullptr};  ///< The current values of the file. Only used through CSnapshotGuard.
+    std::shared_ptr<CKeyStore const> snapshotOwner_;    ///< Owns the current snapshot. Protected by reloadMutex_.
+    std::shared_ptr<CKeyStore const> fileValues_;       ///< The values from the file without the layers. Protected by reloadMutex_.
+    std::atomic<std::uint64_t> generation_{0};          ///< Incremented each time a snapshot is retired.
+    std::array<SReaderCount, 2 * readerStripes> readers_; ///< Lookups in progress by generation (odd/even) and stripe.
+    std::mutex reloadMutex_;                    ///< Serialises reloads. Protects the layers and snapshotOwner_.
+    std::recursive_mutex notifyMutex_;          ///< Serialises the change callbacks, so they are called in the order of the reloads.
+    std::mutex callbackMutex_;                  ///< Protects callbacks_.
+    std::vector<SChangeCallback> callbacks_;    ///< The change callbacks.
+    std::size_t nextCallbackID_ = 1;            ///< ID of the next callback added.
+    std::thread watchThread_;                   ///< The thread watching the file for changes.
+    std::vector<SLayerValue> defaults_;         ///< Default values. Protected by reloadMutex_.
+    std::vector<SLayerValue> commandLine_;      ///< Values from the command line. Protected by reloadMutex_.
+    std::string environmentPrefix_;             ///< Prefix of environment variables. Empty if not used. Protected by reloadMutex_.
+#if defined(__linux__)
+    int inotifyFD_ = -1;                        ///< inotify instance watching the directory of the file.
+    int stopPipe_[2] = {-1, -1};                ///< Written to stop the watch thread.
+#else
+    std::mutex watchMutex_;                     ///< Used with stopCondition_.
+    std::condition_variable stopCondition_;     ///< Signalled to stop the watch thread.
+    bool stopWatch_ = false;                    ///< True if the watch thread must stop.
+#endif
+
+    /// @brief      Returns the key identifying the configuration file and parser settings in the binary cache.
+    /// @details    The key is a hash of the size, modification time and complete text of the file and the parser settings. The
+    ///             text is included so that a file rewritten within the timestamp resolution, or with the timestamp preserved, is
+    ///             not read from a stale cache. The file is mapped, so it is not copied to hash it.
+    /// @returns    The key.
+    /// @throws     std::filesystem::filesystem_error - Unable to read the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - The complete file is hashed, not only the first and last 4kB.
+    /// @version    2026-10-18/GGB - Added the head and tail of the file to the key.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::uint64_t cacheKey() const
+    {
+      std::uintmax_t fileSize = std::filesystem::file_size(filename_);
+      std::string source = std::to_string(fileSize) + '\n' +
+                           std::to_string(std::filesystem::last_write_time(filename_).time_since_epoch().count()) + '\n' +
+                           seperatorChar_ + '\n' + commentChar_ + '\n' + sectionOpenChar_ + '\n' + sectionCloseChar_;
+      boost::interprocess::mapped_region mapRegion;
+      std::string_view fileText;
+
+      if (fileSize != 0)
+      {
+        try
+        {
+          boost::interprocess::file_mapping mapFile(filename_.c_str(), boost::interprocess::read_only);
+
+          mapRegion = boost::interprocess::mapped_region(mapFile, boost::interprocess::read_only);
+          fileText = std::string_view(static_cast<char const *>(mapRegion.get_address()), mapRegion.get_size());
+        }
+        catch(boost::interprocess::interprocess_exception const &)
+        {
+          throw std::filesystem::filesystem_error("Unable to read file", filename_, std::make_error_code(std::errc::io_error));
+        };
+      };
+
+      return CKeyStore::hash(source, fileText);
+    }
+
+    /// @brief      Reads the values from the binary cache if it is enabled and up to date, otherwise parses the file. If the cache is
+    ///             enabled and was not used, a new cache is written.
+    /// @returns    The values.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::unique_ptr<CKeyStore const> readFile() const
+    {
+      std::unique_ptr<CKeyStore const> returnValue;
+
+      if (binaryCache_)
+      {
+        std::filesystem::path cachePath = filename_;
+        std::optional<std::uint64_t> key;
+
+        cachePath += ".cache";
+
+        try
+        {
+          key = cacheKey();
+          returnValue = CKeyStore::openCache(cachePath, *key);
+        }
+        catch(std::filesystem::filesystem_error const &)
+        {
+            // The file does not exist. parseFile() reports the error.
+        };
+
+        if (!returnValue)
+        {
+          bool includes = false;
+          std::unique_ptr<CKeyStore> keyStore = parseFile(&includes);
+
+            // The key only identifies the main file, so files with includes are not cached.
+
+          if (key && !includes && !keyStore->saveCache(cachePath, *key))
+          {
+            logger::DEBUGMESSAGE("READER: Unable to write cache file " + cachePath.string());
+          };
+          returnValue = std::move(keyStore);
+        };
+      }
+      else
+      {
+        returnValue = parseFile();
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Converts a section or tag name to the form used in environment variable names. Letters are converted to upper
+    ///             case and all other characters, except digits, to '_'.
+    /// @param[in]  name: The name to convert.
+    /// @returns    The converted name.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    static std::string environmentName(std::string_view name)
+    {
+      std::string returnValue(name);
+
+      for (char &c : returnValue)
+      {
+        c = std::isalnum(static_cast<unsigned char>(c)) ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : '_';
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Reads the environment variables that override values. The variables are named PREFIX_SECTION__TAG, or
+    ///             PREFIX_TAG for files without sections and tags before the first section. If the name matches a tag in the file
+    ///             or the defaults (see environmentName()), the value replaces that tag, otherwise a tag with the name given in
+    ///             the variable is added.
+    /// @param[in]  fileValues: The values read from the file.
+    /// @returns    The values of the environment variables.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::vector<SLayerValue> readEnvironment(CKeyStore const &fileValues) const
+    {
+      std::vector<SLayerValue> returnValue;
+      std::string const prefix = environmentName(environmentPrefix_) + '_';
+      std::unordered_map<std::string, std::pair<std::string, std::string>> knownNames;
+#if defined(_WIN32)
+      char **environment = _environ;
+#else
+      char **environment = environ;
+#endif
+
+      auto addKnownName = [&](std::string_view section, std::string_view tagName)
+      {
+        std::string name = section.empty() ? environmentName(tagName) : environmentName(section) + "__" + environmentName(tagName);
+
+        knownNames.emplace(std::move(name), std::make_pair(std::string(section), std::string(tagName)));
+      };
+
+      for (; (environment != nullptr) && (*environment != nullptr); ++environment)
+      {
+        std::string_view variable(*environment);
+        std::size_t equals = variable.find('=');
+
+        if ( (equals != std::string_view::npos) && (equals > prefix.size()) && (variable.compare(0, prefix.size(), prefix) == 0) )
+        {
+          std::string_view name = variable.substr(prefix.size(), equals - prefix.size());
+          SLayerValue layerValue;
+
+          if (knownNames.empty())
+          {
+            fileValues.forEach([&](std::string_view section, std::string_view tagName, std::string_view)
+            {
+              addKnownName(section, tagName);
+            });
+
+            for (SLayerValue const &defaultValue : defaults_)
+            {
+              addKnownName(defaultValue.section, defaultValue.tagName);
+            };
+          };
+
+          auto knownName = knownNames.find(std::string(name));
+          std::size_t seperator;
+
+          if (knownName != knownNames.end())
+          {
+            layerValue.section = knownName->second.first;
+            layerValue.tagName = knownName->second.second;
+          }
+          else if (!sectionOpenChar_.empty() && ((seperator = name.find("__")) != std::string_view::npos))
+          {
+            layerValue.section = name.substr(0, seperator);
+            layerValue.tagName = name.substr(seperator + 2);
+          }
+          else
+          {
+            layerValue.tagName = name;
+          };
+
+          layerValue.value = variable.substr(equals + 1);
+          returnValue.push_back(std::move(layerValue));
+        };
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Merges the layers with the values from the file. If no layers are used, the values from the file are returned
+    ///             unchanged.
+    /// @param[in]  fileValues: The values read from the file.
+    /// @returns    The merged values.
+    /// @throws     std::bad_alloc
+    /// @note       Must be called with reloadMutex_ locked.
+    /// @version    2026-10-18/GGB - The values from the file are shared, so they can be merged again when a layer changes.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::shared_ptr<CKeyStore const> applyLayers(std::shared_ptr<CKeyStore const> const &fileValues) const
+    {
+      std::shared_ptr<CKeyStore const> returnValue;
+
+      if (defaults_.empty() && commandLine_.empty() && environmentPrefix_.empty())
+      {
+        returnValue = fileValues;
+      }
+      else
+      {
+        std::unique_ptr<CKeyStore> keyStore = std::make_unique<CKeyStore>();
+        std::vector<SLayerValue> environment;
+
+        if (!environmentPrefix_.empty())
+        {
+          environment = readEnvironment(*fileValues);
+        };
+
+          // The key store keeps the first value inserted, so insert the highest priority layer first. Within a layer the last
+          // value wins.
+
+        keyStore->reserve(commandLine_.size() + environment.size() + fileValues->size() + defaults_.size(), 0);
+
+        for (auto layerValue = commandLine_.rbegin(); layerValue != commandLine_.rend(); ++layerValue)
+        {
+          keyStore->insert(layerValue->section, layerValue->tagName, layerValue->value, "<command line>");
+        };
+
+        for (auto layerValue = environment.rbegin(); layerValue != environment.rend(); ++layerValue)
+        {
+          keyStore->insert(layerValue->section, layerValue->tagName, layerValue->value, "<environment>");
+        };
+
+        fileValues->forEach([&keyStore, &fileValues](std::string_view section, std::string_view tagName, std::string_view value)
+        {
+          std::optional<CKeyStore::SSourceLocation> location = fileValues->location(section, tagName);
+
+          if (location)
+          {
+            keyStore->insert(section, tagName, value, location->file, location->line);
+          }
+          else
+          {
+            keyStore->insert(section, tagName, value);
+          };
+        });
+
+        for (auto layerValue = defaults_.rbegin(); layerValue != defaults_.rend(); ++layerValue)
+        {
+          keyStore->insert(layerValue->section, layerValue->tagName, layerValue->value, "<default>");
+        };
+
+        keyStore->shrink_to_fit();
+        returnValue = std::move(keyStore);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Makes a key store the current snapshot and retires the previous snapshot. Waits until the lookups that may be
+    ///             using the previous snapshot have finished. (See CSnapshotGuard) Must be called with reloadMutex_ locked.
+    /// @param[in]  keyStore: The new snapshot.
+    /// @returns    The previous snapshot. Empty if this is the first snapshot. It is freed when the last pointer to it is
+    ///             released.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Wait for lookups using the previous snapshot, so lookups do not need a lock.
+    /// @version    2026-10-18/GGB - Release old snapshots. (Were kept until the reader was destroyed)
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::shared_ptr<CKeyStore const> publish(std::shared_ptr<CKeyStore const> keyStore)
+    {
+      std::shared_ptr<CKeyStore const> returnValue = std::move(snapshotOwner_);
+
+      snapshotOwner_ = std::move(keyStore);
+      snapshot_.store(snapshotOwner_.get(), std::memory_order_seq_cst);
+
+      if (returnValue)
+      {
+          // Lookups that started before the generation changed may be using the previous snapshot. Lookups that start later
+          // count in the other generation and use the new snapshot.
+
+        std::uint64_t generation = generation_.fetch_add(1, std::memory_order_seq_cst);
+
+        for (std::size_t stripe = 0; stripe < readerStripes; ++stripe)
+        {
+          while (readers_[(generation & 1) * readerStripes + stripe].count.load(std::memory_order_seq_cst) != 0)
+          {
+            std::this_thread::yield();
+          };
+        };
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Calls the change callbacks for the differences between two snapshots.
+    /// @param[in]  oldSnapshot: The previous values.
+    /// @param[in]  newSnapshot: The new values.
+    /// @throws     Any exception thrown by a callback.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void notifyChanges(CKeyStore const &oldSnapshot, CKeyStore const &newSnapshot)
+    {
+      std::vector<SChangeCallback> callbacks;
+
+      {
+        std::lock_guard<std::mutex> lock(callbackMutex_);
+
+        callbacks = callbacks_;
+      }
+
+      if (!callbacks.empty())
+      {
+        auto notify = [&callbacks](std::string_view section, std::string_view tagName, std::optional<std::string_view> value)
+        {
+          for (SChangeCallback const &cb : callbacks)
+          {
+            if ( (cb.section.empty() || (cb.section == section)) && (cb.tagName.empty() || (cb.tagName == tagName)) )
+            {
+              cb.callback(section, tagName, value);
+            };
+          };
+        };
+
+        newSnapshot.forEach([&](std::string_view section, std::string_view tagName, std::string_view value)
+        {
+          std::optional<std::string_view> oldValue = oldSnapshot.find(section, tagName);
+
+          if (!oldValue || (*oldValue != value))
+          {
+            notify(section, tagName, value);
+          };
+        });
+
+        oldSnapshot.forEach([&](std::string_view section, std::string_view tagName, std::string_view)
+        {
+          if (!newSnapshot.find(section, tagName))
+          {
+            notify(section, tagName, std::nullopt);
+          };
+        });
+      };
+    }
+
+    /// @brief      Merges the layers with the values from the file again and publishes the result, after a layer is changed. The
+    ///             file is not read. The change callbacks are called for each tag that was added, changed or removed. Does
+    ///             nothing if the file has not been loaded yet, as the layers are merged when it is loaded.
+    /// @throws     std::bad_alloc
+    /// @throws     Any exception thrown by a callback.
+    /// @note       Called without reloadMutex_ locked.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void layersChanged()
+    {
+      std::lock_guard<std::recursive_mutex> notifyLock(notifyMutex_);
+      std::shared_ptr<CKeyStore const> oldSnapshot;
+      std::shared_ptr<CKeyStore const> newSnapshot;
+
+      {
+        std::lock_guard<std::mutex> lock(reloadMutex_);
+
+        if (fileValues_)
+        {
+          oldSnapshot = publish(applyLayers(fileValues_));
+          newSnapshot = snapshotOwner_;
+        };
+      }
+
+      if (oldSnapshot)
+      {
+        notifyChanges(*oldSnapshot, *newSnapshot);
+      };
+    }
+
+    /// @brief      Reloads the file and logs any errors. Used by the watch thread.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void reloadChanged() noexcept
+    {
+      try
+      {
+        reload();
+      }
+      catch(std::exception const &e)
+      {
+        logger::ERRORMESSAGE("READER: Unable to reload " + filename_.string() + ": " + e.what());
+      };
+    }
+
+#if defined(__linux__)
+    /// @brief      Watch thread. Waits for inotify events for the file and reloads the file when it is written or replaced.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void watchFile() noexcept
+    {
+      std::string const fileName = filename_.filename().string();
+      pollfd pollFDs[2] = { {inotifyFD_, POLLIN, 0}, {stopPipe_[0], POLLIN, 0} };
+      alignas(inotify_event) char buffer[4096];
+      bool stop = false;
+
+      while (!stop)
+      {
+        if (poll(pollFDs, 2, -1) < 0)
+        {
+          stop = (errno != EINTR);
+        }
+        else if (pollFDs[1].revents != 0)
+        {
+          stop = true;
+        }
+        else if (pollFDs[0].revents & POLLIN)
+        {
+          bool changed = false;
+          ssize_t length;
+
+          while ((length = read(inotifyFD_, buffer, sizeof(buffer))) > 0)
+          {
+            char const *event = buffer;
+
+            while (event < buffer + length)
+            {
+              inotify_event const *inotifyEvent = reinterpret_cast<inotify_event const *>(event);
+
+              if ((inotifyEvent->len != 0) && (fileName == inotifyEvent->name))
+              {
+                changed = true;
+              };
+
+              event += sizeof(inotify_event) + inotifyEvent->len;
+            };
+          };
+
+          if (changed)
+          {
+            reloadChanged();
+          };
+        };
+      };
+    }
+#else
+    /// @brief      Watch thread. Polls the modification time of the file and reloads the file when it changes.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void watchFile() noexcept
+    {
+      std::error_code ec;
+      std::filesystem::file_time_type lastWrite = std::filesystem::last_write_time(filename_, ec);
+      std::unique_lock<std::mutex> lock(watchMutex_);
+
+      while (!stopCondition_.wait_for(lock, std::chrono::seconds(1), [this] { return stopWatch_; }))
+      {
+        std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(filename_, ec);
+
+        if (!ec && (writeTime != lastWrite))
+        {
+          lastWrite = writeTime;
+          lock.unlock();
+          reloadChanged();
+          lock.lock();
+        };
+      };
+    }
+#endif
+
+  protected:
+    std::filesystem::path filename_;          ///< Filename and path of the configuration file
+    std::string seperatorChar_;               ///< The seperator character to use between token and value.
+    std::string commentChar_;                 ///< Character(s) used to start comment lines.
+    std::string sectionOpenChar_;             ///< The character(s) opening section declarations. Empty if there are no sections.
+    std::string sectionCloseChar_;            ///< The character(s) closing section declarations.
+    bool readComplete_ = false;               ///< True if the entire file has been read.
+    bool binaryCache_ = false;                ///< True if a binary cache file is used.
+
+    /// @brief      Removes leading and trailing whitespace from a string view.
+    /// @param[in]  sv: The view to trim.
+    /// @returns    The trimmed view.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    static std::string_view trimView(std::string_view sv) noexcept
+    {
+      std::size_t first = sv.find_first_not_of(" \t\r\n");
+      std::size_t last = sv.find_last_not_of(" \t\r\n");
+
+      return (first == std::string_view::npos) ? std::string_view() : sv.substr(first, last - first + 1);
+    }
+
+    /// @brief  Gives a lookup access to the current snapshot. The snapshot is not freed while the guard exists, so views into it
+    ///         are valid until the guard is destroyed. Registering the lookup is two atomic increments on a counter of the
+    ///         thread's stripe, and is only repeated if a reload retires a snapshot at the same time. Lookups never wait for a
+    ///         lock. Guards must not be held while reloading.
+
+    class CSnapshotGuard
+    {
+    private:
+      std::atomic<std::uint32_t> *count_ = nullptr;
+      CKeyStore const *keyStore_ = nullptr;
+
+    public:
+      CSnapshotGuard(CSnapshotGuard const &) = delete;
+      CSnapshotGuard &operator =(CSnapshotGuard const &) = delete;
+
+      /// @brief      Registers a lookup. The file is loaded if this is the first lookup.
+      /// @param[in]  reader: The reader.
+      /// @throws     GCL::runtime_error - Unable to open the file.
+      /// @throws     std::bad_alloc
+      /// @version    2026-10-18/GGB - Function created.
+
+      explicit CSnapshotGuard(CReaderCore &reader)
+      {
+        static thread_local std::size_t const stripe = std::hash<std::thread::id>()(std::this_thread::get_id()) % readerStripes;
+        bool registered = false;
+
+        if (reader.snapshot_.load(std::memory_order_acquire) == nullptr)
+        {
+          reader.loadFile();
+        };
+
+        while (!registered)
+        {
+          std::uint64_t generation = reader.generation_.load(std::memory_order_seq_cst);
+
+          count_ = &reader.readers_[(generation & 1) * readerStripes + stripe].count;
+          count_->fetch_add(1, std::memory_order_seq_cst);
+
+            // If a snapshot was retired in between, the reload may not have seen this count. Count again.
+
+          registered = (reader.generation_.load(std::memory_order_seq_cst) == generation);
+          if (!registered)
+          {
+            count_->fetch_sub(1, std::memory_order_release);
+          };
+        };
+
+        keyStore_ = reader.snapshot_.load(std::memory_order_seq_cst);
+      }
+
+      ~CSnapshotGuard()
+      {
+        count_->fetch_sub(1, std::memory_order_release);
+      }
+
+      CKeyStore const *operator->() const noexcept { return keyStore_; }
+      CKeyStore const &operator*() const noexcept { return *keyStore_; }
+    };
+
+    /// @brief      Returns a guard giving access to the current snapshot. The file is loaded if this is the first lookup.
+    /// @returns    The guard. Views into the snapshot are valid while the guard exists.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Return a guard, so that old snapshots can be freed without locking lookups.
+    /// @version    2026-10-18/GGB - Load the file on the first call.
+    /// @version    2026-10-18/GGB - Function created.
+
+    CSnapshotGuard snapshot()
+    {
+      return CSnapshotGuard(*this);
+    }
+
+    /// @brief      Returns a shared pointer to the current snapshot, that keeps it alive after reloads.
+    /// @returns    The current snapshot.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::shared_ptr<CKeyStore const> sharedSnapshot()
+    {
+      return snapshot()->shared_from_this();
+    }
+
+    /// @brief      Returns a view of a tag value that stays valid after reloads.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    The view, if the tag was found.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::optional<CValueView> valueView(std::string_view section, std::string_view tagName)
+    {
+      std::optional<CValueView> returnValue;
+      CSnapshotGuard values = snapshot();
+      std::optional<std::string_view> value = values->find(section, tagName);
+
+      if (value)
+      {
+        returnValue.emplace(values->shared_from_this(), *value);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Returns where the value of a tag came from.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    The location if the tag was found and the location is known.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::optional<STagLocation> location(std::string_view section, std::string_view tagName)
+    {
+      std::optional<STagLocation> returnValue;
+      CSnapshotGuard values = snapshot();
+      std::optional<CKeyStore::SSourceLocation> location = values->location(section, tagName);
+
+      if (location)
+      {
+        returnValue = STagLocation{std::string(location->file), location->line};
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Memory maps a configuration file and parses the sections, tags and include lines in a single pass. Included
+    ///             files are not parsed.
+    /// @param[in]  filename: The file to parse.
+    /// @param[in]  name: The name of the file used in source locations and error messages.
+    /// @returns    The values and include lines. The views refer to the mapped file.
+    /// @throws     GCL::runtime_error - Unable to open the file, or a file or directory that is included does not exist.
+    /// @throws     std::bad_alloc
+    /// @note       Called from several threads at once when included files are parsed.
+    /// @version    2026-10-18/GGB - Function created.
+
+    SParsedFile parseText(std::filesystem::path const &filename, std::string const &name) const
+    {
+      SParsedFile returnValue;
+      std::string_view fileText;
+      std::string_view szSection;
+      std::uint32_t lineNumber = 0;
+
+      returnValue.name = name;
+
+      try
+      {
+        if (std::filesystem::file_size(filename) != 0)
+        {
+          boost::interprocess::file_mapping mapFile(filename.c_str(), boost::interprocess::read_only);
+
+          returnValue.mapRegion = boost::interprocess::mapped_region(mapFile, boost::interprocess::read_only);
+          fileText = std::string_view(static_cast<char const *>(returnValue.mapRegion.get_address()),
+                                      returnValue.mapRegion.get_size());
+        };
+      }
+      catch(std::exception const &)
+      {
+        RUNTIME_ERROR(boost::locale::translate("Unable to open configuration file.").str() + " (" + name + ")");
+      };
+
+        // There is at most one value for each line.
+
+      returnValue.values.reserve(static_cast<std::size_t>(std::count(fileText.begin(), fileText.end(), '\n')) + 1);
+
+      while (!fileText.empty())
+      {
+        std::size_t lineEnd = fileText.find('\n');
+        std::string_view szLine = trimView(fileText.substr(0, lineEnd));
+        std::size_t indexStart;
+
+        fileText.remove_prefix(lineEnd == std::string_view::npos ? fileText.size() : lineEnd + 1);
+        ++lineNumber;
+
+        if ((indexStart = szLine.find(commentChar_)) != std::string_view::npos)
+        {
+          szLine = szLine.substr(0, indexStart);
+        };
+
+        if (szLine.empty())
+        {
+            // Blank or comment line.
+        }
+        else if (isIncludeLine(szLine, "include_dir") || isIncludeLine(szLine, "include"))
+        {
+          bool includeDirectory = isIncludeLine(szLine, "include_dir");
+          std::string_view target = trimView(szLine.substr(includeDirectory ? 11 : 7));
+          std::filesystem::path includePath;
+          std::vector<std::filesystem::path> files;
+
+          if ((target.size() >= 2) && (target.front() == '"') && (target.back() == '"'))
+          {
+            target = target.substr(1, target.size() - 2);
+          };
+
+          includePath = filename.parent_path() / std::filesystem::path(target);
+
+          if (includeDirectory)
+          {
+            std::error_code ec;
+
+            for (std::filesystem::directory_iterator iterator(includePath, ec), end; !ec && (iterator != end);
+                 iterator.increment(ec))
+            {
+              std::filesystem::path const &file = iterator->path();
+
+              if ( iterator->is_regular_file() && (file.extension() == filename.extension()) &&
+                   (file.filename().string().front() != '.') )
+              {
+                files.push_back(std::filesystem::weakly_canonical(file));
+              };
+            };
+
+            if (ec)
+            {
+              RUNTIME_ERROR(boost::locale::translate("Unable to read included configuration directory.").str() + " (" + name +
+                            ":" + std::to_string(lineNumber) + ")");
+            };
+
+            std::sort(files.begin(), files.end());
+          }
+          else if (std::filesystem::is_regular_file(includePath))
+          {
+            files.push_back(std::filesystem::weakly_canonical(includePath));
+          }
+          else
+          {
+            RUNTIME_ERROR(boost::locale::translate("Included configuration file not found.").str() + " (" + name + ":" +
+                          std::to_string(lineNumber) + " includes " + includePath.string() + ")");
+          };
+
+          returnValue.values.push_back(SParsedValue{szSection, std::string_view(), std::string_view(), lineNumber,
+                                                    returnValue.includes.size()});
+          returnValue.includes.push_back(std::move(files));
+        }
+        else if (!sectionOpenChar_.empty() && ((indexStart = szLine.find(sectionOpenChar_)) != std::string_view::npos))
+        {
+          std::size_t nameStart = indexStart + sectionOpenChar_.size();
+
+          szSection = trimView(szLine.substr(nameStart, szLine.find(sectionCloseChar_, nameStart) - nameStart));
+        }
+        else if ((indexStart = szLine.find(seperatorChar_)) != std::string_view::npos)
+        {
+          returnValue.values.push_back(SParsedValue{szSection, trimView(szLine.substr(0, indexStart)),
+                                                    trimView(szLine.substr(indexStart + seperatorChar_.size())), lineNumber,
+                                                    static_cast<std::size_t>(-1)});
+        };
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Checks if a line is an include line. The keyword must be followed by whitespace, and the line must not contain
+    ///             the seperator, so that tags called "include" are still values.
+    /// @param[in]  szLine: The trimmed line.
+    /// @param[in]  keyword: "include" or "include_dir"
+    /// @returns    true if the line is an include line.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    bool isIncludeLine(std::string_view szLine, std::string_view keyword) const noexcept
+    {
+      return (szLine.size() > keyword.size()) && (szLine.substr(0, keyword.size()) == keyword) &&
+             std::isspace(static_cast<unsigned char>(szLine[keyword.size()])) &&
+             (szLine.find(seperatorChar_) == std::string_view::npos);
+    }
+
+    /// @brief      Adds the values of a parsed file, and the files it includes, to a key store.
+    /// @param[in]  keyStore: The key store to add the values to.
+    /// @param[in]  parsedFiles: All the parsed files.
+    /// @param[in]  filename: The canonical path of the file to add.
+    /// @param[in]  includeStack: The files that are including this file.
+    /// @param[in]  mergedFiles: The files that have already been merged. Files in the set are not merged again.
+    /// @throws     GCL::runtime_error - The files include each other.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Files included more than once are merged once.
+    /// @version    2026-10-18/GGB - Values from later files override values from earlier files.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void mergeFile(CKeyStore &keyStore, std::map<std::filesystem::path, SParsedFile> const &parsedFiles,
+                   std::filesystem::path const &filename, std::vector<std::filesystem::path> &includeStack,
+                   std::set<std::filesystem::path> &mergedFiles) const
+    {
+      SParsedFile const &parsedFile = parsedFiles.at(filename);
+
+      includeStack.push_back(filename);
+      mergedFiles.insert(filename);
+
+      for (SParsedValue const &parsedValue : parsedFile.values)
+      {
+        if (parsedValue.include == static_cast<std::size_t>(-1))
+        {
+            // A value from a later file overrides the value from an earlier file. Within a file the first value is kept.
+
+          if (!keyStore.insert(parsedValue.section, parsedValue.tagName, parsedValue.value, parsedFile.name, parsedValue.line))
+          {
+            std::optional<CKeyStore::SSourceLocation> location = keyStore.location(parsedValue.section, parsedValue.tagName);
+
+            if (!location || (location->file != parsedFile.name))
+            {
+              keyStore.assign(parsedValue.section, parsedValue.tagName, parsedValue.value, parsedFile.name, parsedValue.line);
+            };
+          };
+        }
+        else
+        {
+          for (std::filesystem::path const &includedFile : parsedFile.includes[parsedValue.include])
+          {
+            if (std::find(includeStack.begin(), includeStack.end(), includedFile) != includeStack.end())
+            {
+              RUNTIME_ERROR(boost::locale::translate("Configuration files include each other.").str() + " (" + parsedFile.name +
+                            ":" + std::to_string(parsedValue.line) + " includes " + includedFile.string() + ")");
+            };
+
+            if (mergedFiles.find(includedFile) == mergedFiles.end())
+            {
+              mergeFile(keyStore, parsedFiles, includedFile, includeStack, mergedFiles);
+            };
+          };
+        };
+      };
+
+      includeStack.pop_back();
+    }
+
+    /// @brief      Parses the configuration file, and any files it includes, into a key store. The main file is parsed first, then
+    ///             each level of included files is parsed in parallel. The values are then merged in the order they are included.
+    /// @param[out] includes: Set to true if the file includes other files. May be nullptr.
+    /// @returns    The key store holding the values.
+    /// @throws     GCL::runtime_error - Unable to open a file, or the files include each other.
+    /// @throws     std::bad_alloc
+    /// @note       Tags that appear before the first section, or in files without sections, are stored in the section "".
+    /// @version    2026-10-18/GGB - Include and include_dir lines. Parsing moved to parseText().
+    /// @version    2026-10-18/GGB - Moved from CReaderSections. Sections are optional.
+    /// @version    2026-10-18/GGB - Return a new key store.
+    /// @version    2026-10-18/GGB - Store the values in keyStore_.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::unique_ptr<CKeyStore> parseFile(bool *includes = nullptr) const
+    {
+      std::unique_ptr<CKeyStore> returnValue = std::make_unique<CKeyStore>();
+      std::map<std::filesystem::path, SParsedFile> parsedFiles;
+      std::error_code ec;
+      std::filesystem::path mainFile = std::filesystem::weakly_canonical(filename_, ec);
+      std::vector<std::filesystem::path> pendingFiles;
+      std::vector<std::filesystem::path> includeStack;
+      std::set<std::filesystem::path> mergedFiles;
+      std::size_t valueCount = 0;
+      std::size_t textSize = 0;
+
+      if (ec)
+      {
+        mainFile = filename_;
+      };
+
+      parsedFiles.emplace(mainFile, parseText(filename_, filename_.string()));
+      pendingFiles.push_back(mainFile);
+
+      while (!pendingFiles.empty())
+      {
+        std::vector<std::filesystem::path> newFiles;
+
+          // Find the files included by the last level that have not been parsed.
+
+        for (std::filesystem::path const &pendingFile : pendingFiles)
+        {
+          for (std::vector<std::filesystem::path> const &files : parsedFiles.at(pendingFile).includes)
+          {
+            for (std::filesystem::path const &file : files)
+            {
+              if ( (parsedFiles.find(file) == parsedFiles.end()) &&
+                   (std::find(newFiles.begin(), newFiles.end(), file) == newFiles.end()) )
+              {
+                newFiles.push_back(file);
+              };
+            };
+          };
+        };
+
+        if (!newFiles.empty())
+        {
+          std::vector<std::optional<SParsedFile>> results(newFiles.size());
+          std::vector<std::exception_ptr> errors(newFiles.size());
+          std::atomic<std::size_t> nextFile{0};
+          std::vector<std::thread> threads(std::min<std::size_t>(newFiles.size(),
+                                                                 std::max(std::thread::hardware_concurrency(), 1U)) - 1);
+
+          auto parseFiles = [&]()
+          {
+            std::size_t index;
+
+            while ((index = nextFile.fetch_add(1)) < newFiles.size())
+            {
+              try
+              {
+                results[index] = parseText(newFiles[index], newFiles[index].string());
+              }
+              catch(...)
+              {
+                errors[index] = std::current_exception();
+              };
+            };
+          };
+
+          for (std::thread &thread : threads)
+          {
+            thread = std::thread(parseFiles);
+          };
+
+          parseFiles();
+
+          for (std::thread &thread : threads)
+          {
+            thread.join();
+          };
+
+            // Report the first error in file order, so the error does not depend on the order the threads ran.
+
+          for (std::size_t index = 0; index < newFiles.size(); ++index)
+          {
+            if (errors[index])
+            {
+              std::rethrow_exception(errors[index]);
+            };
+
+            parsedFiles.emplace(newFiles[index], std::move(*results[index]));
+          };
+        };
+
+        pendingFiles = std::move(newFiles);
+      };
+
+      for (auto const &parsedFile : parsedFiles)
+      {
+        valueCount += parsedFile.second.values.size();
+        textSize += parsedFile.second.mapRegion.get_size();
+      };
+
+        // The text can not be larger than the files, so reserve the space to avoid reallocating while merging.
+
+      returnValue->reserve(valueCount, textSize);
+      mergeFile(*returnValue, parsedFiles, mainFile, includeStack, mergedFiles);
+      returnValue->shrink_to_fit();
+
+      if (includes != nullptr)
+      {
+        *includes = (parsedFiles.size() > 1);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Formats a source location for messages.
+    /// @param[in]  location: The location.
+    /// @returns    "file:line", or "file" if there is no line number.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    static std::string locationString(CKeyStore::SSourceLocation const &location)
+    {
+      std::string returnValue(location.file);
+
+      if (location.line != 0)
+      {
+        returnValue += ":" + std::to_string(location.line);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Loads the file and publishes the first snapshot. Does nothing if the file has already been loaded.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    void loadFile()
+    {
+      std::lock_guard<std::mutex> lock(reloadMutex_);
+
+      if (!snapshotOwner_)
+      {
+        fileValues_ = readFile();
+        publish(applyLayers(fileValues_));
+        readComplete_ = true;
+      };
+    }
+
+    /// @brief      Returns a converted tag value. The converted value is cached.
+    /// @tparam     T: The type of the value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @param[in]  conversion: The cache slot for the conversion.
+    /// @param[in]  convert: The conversion function.
+    /// @returns    A std::optional containing the data (if found and converted)
+    /// @throws     std::runtime_error - The value was not able to be converted. The message includes the source location.
+    /// @version    2026-10-18/GGB - Add the source location to conversion errors.
+    /// @version    2026-10-18/GGB - Function created.
+
+    template<typename T, typename F>
+    std::optional<T> convertedValue(std::string_view section, std::string_view tagName, CKeyStore::EConversion conversion,
+                                    F &&convert)
+    {
+      CSnapshotGuard values = snapshot();
+      std::optional<T> returnValue;
+
+      try
+      {
+        returnValue = values->findConverted<T>(section, tagName, conversion, std::forward<F>(convert));
+      }
+      catch(std::runtime_error const &e)
+      {
+        std::optional<CKeyStore::SSourceLocation> location = values->location(section, tagName);
+
+        if (location)
+        {
+          throw std::runtime_error(std::string(e.what()) + " (" + locationString(*location) + ")");
+        }
+        else
+        {
+          throw;
+        };
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Splits a tag name into the section and tag. The default implementation has no sections.
+    /// @param[in]  tagName: The tag name.
+    /// @returns    The section and the tag.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::pair<std::string_view, std::string_view> splitTagName(std::string_view tagName) const noexcept
+    {
+      return {std::string_view(), trimView(tagName)};
+    }
+
+    /// @brief      Returns the value of a tag.
+    /// @param[in]  tagName: The name of the tag. Passed to splitTagName().
+    /// @returns    Standard optional with the value if found. If the tag is not found then the optional has no value.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @version    2026-10-18/GGB - Implemented in the base class using the snapshot.
+    /// @version    2020-04-27/GGB - Function created.
+
+    virtual std::optional<std::string> readTag(std::string const &tagName)
+    {
+      std::optional<std::string> returnValue;
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+      CSnapshotGuard values = snapshot();
+      std::optional<std::string_view> value = values->find(sectionTag.first, sectionTag.second);
+
+      if (value)
+      {
+        returnValue = std::string(*value);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Compares two strings ignoring case.
+    /// @param[in]  lhs: The first string.
+    /// @param[in]  rhs: The second string.
+    /// @returns    true if the strings are equal.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    static bool equalNoCase(std::string_view lhs, std::string_view rhs) noexcept
+    {
+      return (lhs.size() == rhs.size()) &&
+             std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](char l, char r)
+             {
+               return std::tolower(static_cast<unsigned char>(l)) == std::tolower(static_cast<unsigned char>(r));
+             });
+    }
+
+    /// @brief      Converts a string to an integer type. The string may have a sign and a "0x" prefix for hexadecimal values.
+    /// @param[in]  s: The string to convert. The whole string must be used.
+    /// @returns    The converted value, or an empty optional if the string is not a valid value of the type.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    template<typename T>
+    static std::optional<T> parseInteger(std::string_view s) noexcept
+    {
+      std::optional<T> returnValue;
+      bool negative = false;
+      int base = 10;
+      std::uint64_t magnitude;
+
+      if (!s.empty() && ((s.front() == '+') || (s.front() == '-')))
+      {
+        negative = (s.front() == '-');
+        s.remove_prefix(1);
+      };
+
+      if ((s.size() > 2) && (s[0] == '0') && ((s[1] == 'x') || (s[1] == 'X')))
+      {
+        base = 16;
+        s.remove_prefix(2);
+      };
 
-  class CReaderCore
-  {
-  private:
-    CReaderCore() = delete;
-    CReaderCore(CReaderCore const &) = delete;
-    CReaderCore(CReaderCore &&) = delete;
-    CReaderCore &operator =(CReaderCore const &) = delete;
+      std::from_chars_result result = std::from_chars(s.data(), s.data() + s.size(), magnitude, base);
 
-  protected:
-    std::filesystem::path filename_;          ///< Filename and path of the configuration file
-    std::string seperatorChar_;               ///< The seperator character to use between token and value.
-    std::string commentChar_;                 ///< Character(s) used to start comment lines.
-    std::size_t lastLine_ = 0;                ///< Last line read in the file.
-    std::size_t const readAhead_ = 10;        ///< Number of tags to read ahead.
-    bool readComplete_ = false;               ///< True if the entire file has been read.
+      if (!s.empty() && (result.ec == std::errc()) && (result.ptr == s.data() + s.size()))
+      {
+        if (!negative)
+        {
+          if (magnitude <= static_cast<std::uint64_t>(std::numeric_limits<T>::max()))
+          {
+            returnValue = static_cast<T>(magnitude);
+          };
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+          if (magnitude <= static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + 1)
+          {
+            returnValue = static_cast<T>(0 - magnitude);
+          };
+        }
+        else if (magnitude == 0)
+        {
+          returnValue = 0;
+        };
+      };
 
-    virtual std::optional<std::string> readTag(std::string const &) = 0;
+      return returnValue;
+    }
 
     /// @brief Returns a double tag value.
-    /// @param[in] to s: The name of the tag to find.
+    /// @param[in] s: The string to convert.
     /// @returns The string converted to a double.
     /// @throws std::runtime_error - The value was not able to be converted.
+    /// @version 2026-10-18/GGB - Use std::from_chars. The whole string must be a number.
     /// @version 2020-04-27/GGB - Function created.
 
-    virtual double string2Double(std::string const &s)
+    virtual double string2Double(std::string_view s)
     {
       double returnValue;
 
-      try
+      if (!s.empty() && (s.front() == '+'))
       {
-        returnValue = std::stod(s);  // According to standard if the stod throws, then the optional should be false.
-      }
-      catch(std::invalid_argument const &e)
-      {
-        // Could not convert the value.
+        s.remove_prefix(1);
+      };
 
-        DEBUGMESSAGE(e.what());
-        throw std::runtime_error("Unable to convert tag value to double");
-      }
-      catch(std::out_of_range const &e)
-      {
-        // Unusual to get an double that is out of range.
+      std::from_chars_result result = std::from_chars(s.data(), s.data() + s.size(), returnValue);
 
-        DEBUGMESSAGE(e.what());
+      if (s.empty() || (result.ec != std::errc()) || (result.ptr != s.data() + s.size()))
+      {
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to double");
         throw std::runtime_error("Unable to convert tag value to double");
       };
 
@@ -107,58 +1375,241 @@ namespace GCL
     }
 
     /// @brief Returns an uint16 tag value.
-    /// @param[in] s: The name of the tag to find.
+    /// @param[in] s: The string to convert.
     /// @returns The string converted to a uint16.
-    /// @throws std::runtime_error - The value was not able to be converted.
-    /// @throws std::out_of_range - The value was too large for the type.
+    /// @throws std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version 2026-10-18/GGB - Use std::from_chars.
     /// @version 2020-04-27/GGB - Function created.
 
-    virtual std::uint16_t string2UInt16(std::string const &s)
+    virtual std::uint16_t string2UInt16(std::string_view s)
     {
-      std::uint16_t returnValue;
+      std::optional<std::uint16_t> returnValue = parseInteger<std::uint16_t>(s);
 
-      try
-      {
-        returnValue = boost::lexical_cast<std::uint16_t>(s);
-      }
-      catch(boost::bad_lexical_cast const &e)
+      if (!returnValue)
       {
-        // Could not convert the value.
-
-        DEBUGMESSAGE(e.what());
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to Uint16");
         throw std::runtime_error("Unable to convert tag value to Uint16");
       };
 
-      return returnValue;
+      return *returnValue;
     }
 
     /// @brief Returns an int32 tag value.
-    /// @param[in] s: The name of the tag to find.
+    /// @param[in] s: The string to convert.
     /// @returns A string conveted to an int32.
-    /// @throws std::runtime_error - The value was not able to be converted.
+    /// @throws std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version 2026-10-18/GGB - Use std::from_chars.
     /// @version 2020-04-27/GGB - Function created.
 
-    virtual std::int32_t string2Int32(std::string const &s)
+    virtual std::int32_t string2Int32(std::string_view s)
     {
-      std::int32_t returnValue;
+      std::optional<std::int32_t> returnValue = parseInteger<std::int32_t>(s);
 
-      try
+      if (!returnValue)
+      {
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to std::int32_t");
+        throw std::runtime_error("Unable to convert tag value to std::int32_t");
+      };
+
+      return *returnValue;
+    }
+
+    /// @brief      Returns an int64 tag value.
+    /// @param[in]  s: The string to convert.
+    /// @returns    The string converted to an int64.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::int64_t string2Int64(std::string_view s)
+    {
+      std::optional<std::int64_t> returnValue = parseInteger<std::int64_t>(s);
+
+      if (!returnValue)
+      {
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to std::int64_t");
+        throw std::runtime_error("Unable to convert tag value to std::int64_t");
+      };
+
+      return *returnValue;
+    }
+
+    /// @brief      Returns a uint64 tag value.
+    /// @param[in]  s: The string to convert.
+    /// @returns    The string converted to a uint64.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::uint64_t string2UInt64(std::string_view s)
+    {
+      std::optional<std::uint64_t> returnValue = parseInteger<std::uint64_t>(s);
+
+      if (!returnValue)
+      {
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to std::uint64_t");
+        throw std::runtime_error("Unable to convert tag value to std::uint64_t");
+      };
+
+      return *returnValue;
+    }
+
+    /// @brief      Returns a bool tag value. (true/false, yes/no, on/off, 1/0. Case is ignored.)
+    /// @param[in]  s: The string to convert.
+    /// @returns    The string converted to a bool.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual bool string2Bool(std::string_view s)
+    {
+      bool returnValue;
+
+      if (equalNoCase(s, "true") || equalNoCase(s, "yes") || equalNoCase(s, "on") || (s == "1"))
       {
-        returnValue = std::stol(s, 0, 0);  // According to standard if the stod throws, then the optional should be false.
+        returnValue = true;
       }
-      catch(std::invalid_argument const &e)
+      else if (equalNoCase(s, "false") || equalNoCase(s, "no") || equalNoCase(s, "off") || (s == "0"))
       {
-        // Could not convert the value.
+        returnValue = false;
+      }
+      else
+      {
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to bool");
+        throw std::runtime_error("Unable to convert tag value to bool");
+      };
 
-        DEBUGMESSAGE(e.what());
-        throw std::runtime_error("Unable to convert tag value to std::int32_t");
+      return returnValue;
+    }
+
+    /// @brief      Returns a duration tag value. The value is an integer followed by an optional unit. (ns, us, ms, s, m, min, h,
+    ///             d) If there is no unit, the value is in seconds. eg "250ms", "30 s", "2h"
+    /// @param[in]  s: The string to convert.
+    /// @returns    The string converted to a duration.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::chrono::nanoseconds string2Duration(std::string_view s)
+    {
+      std::size_t unitStart = s.find_first_not_of("+-0123456789");
+      std::optional<std::int64_t> count = parseInteger<std::int64_t>(s.substr(0, unitStart));
+      std::string_view unit = (unitStart == std::string_view::npos) ? std::string_view() : s.substr(unitStart);
+      std::int64_t multiplier = 0;
+
+      unit.remove_prefix(std::min(unit.size(), unit.find_first_not_of(" \t")));
+
+      if (unit.empty() || (unit == "s"))
+      {
+        multiplier = 1000000000;
+      }
+      else if (unit == "ns")
+      {
+        multiplier = 1;
+      }
+      else if (unit == "us")
+      {
+        multiplier = 1000;
       }
-      catch(std::out_of_range const &e)
+      else if (unit == "ms")
       {
-        // Unusual to get an double that is out of range.
+        multiplier = 1000000;
+      }
+      else if ((unit == "m") || (unit == "min"))
+      {
+        multiplier = 60LL * 1000000000;
+      }
+      else if (unit == "h")
+      {
+        multiplier = 3600LL * 1000000000;
+      }
+      else if (unit == "d")
+      {
+        multiplier = 86400LL * 1000000000;
+      };
 
-        DEBUGMESSAGE(e.what());
-        throw std::runtime_error("Unable to convert tag value to std::int32_t");
+      if (!count || (multiplier == 0) ||
+          (*count > std::numeric_limits<std::int64_t>::max() / multiplier) ||
+          (*count < std::numeric_limits<std::int64_t>::min() / multiplier))
+      {
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to a duration");
+        throw std::runtime_error("Unable to convert tag value to duration");
+      };
+
+      return std::chrono::nanoseconds(*count * multiplier);
+    }
+
+    /// @brief      Returns a size in bytes. The value is an integer followed by an optional unit. (B, K, KB, KiB, M, MB, MiB, G,
+    ///             GB, GiB, T, TB, TiB. Case is ignored.) All units are multiples of 1024. The value must be decimal. eg "64MB", "512 k"
+    /// @param[in]  s: The string to convert.
+    /// @returns    The number of bytes.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::uint64_t string2ByteSize(std::string_view s)
+    {
+      std::size_t unitStart = s.find_first_not_of("+0123456789");
+      std::optional<std::uint64_t> count = parseInteger<std::uint64_t>(s.substr(0, unitStart));
+      std::string_view unit = (unitStart == std::string_view::npos) ? std::string_view() : s.substr(unitStart);
+      std::uint64_t multiplier = 0;
+
+      unit.remove_prefix(std::min(unit.size(), unit.find_first_not_of(" \t")));
+
+      if (unit.empty() || equalNoCase(unit, "b"))
+      {
+        multiplier = 1;
+      }
+      else if (equalNoCase(unit, "k") || equalNoCase(unit, "kb") || equalNoCase(unit, "kib"))
+      {
+        multiplier = 1ULL << 10;
+      }
+      else if (equalNoCase(unit, "m") || equalNoCase(unit, "mb") || equalNoCase(unit, "mib"))
+      {
+        multiplier = 1ULL << 20;
+      }
+      else if (equalNoCase(unit, "g") || equalNoCase(unit, "gb") || equalNoCase(unit, "gib"))
+      {
+        multiplier = 1ULL << 30;
+      }
+      else if (equalNoCase(unit, "t") || equalNoCase(unit, "tb") || equalNoCase(unit, "tib"))
+      {
+        multiplier = 1ULL << 40;
+      };
+
+      if (!count || (multiplier == 0) || (*count > std::numeric_limits<std::uint64_t>::max() / multiplier))
+      {
+        DEBUGMESSAGE("Unable to convert '" + std::string(s) + "' to a byte size");
+        throw std::runtime_error("Unable to convert tag value to byte size");
+      };
+
+      return *count * multiplier;
+    }
+
+    /// @brief      Splits a list value into its items. Whitespace around each item is removed.
+    /// @param[in]  s: The string to split.
+    /// @param[in]  seperator: The character seperating the items.
+    /// @returns    The items. An empty string returns an empty list.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::vector<std::string> string2List(std::string_view s, char seperator)
+    {
+      std::vector<std::string> returnValue;
+
+      if (s.find_first_not_of(" \t") != std::string_view::npos)
+      {
+        std::size_t itemStart = 0;
+        std::size_t itemEnd;
+
+        do
+        {
+          itemEnd = s.find(seperator, itemStart);
+
+          std::string_view item = s.substr(itemStart, itemEnd - itemStart);
+          std::size_t first = item.find_first_not_of(" \t");
+
+          item = (first == std::string_view::npos) ? std::string_view() : item.substr(first, item.find_last_not_of(" \t") - first + 1);
+          returnValue.emplace_back(item);
+
+          itemStart = itemEnd + 1;
+        }
+        while (itemEnd != std::string_view::npos);
       };
 
       return returnValue;
@@ -170,16 +1621,282 @@ namespace GCL
     /// @param[in] filename: The filename and path of the configuration file.
     /// @param[in] seperatorChar: The character(s) used for seperating statements.
     /// @param[in] commentChar: The character(s) used for indicating comments.
+    /// @param[in] sectionOpenChar: The character(s) opening section declarations. Empty if the file does not have sections.
+    /// @param[in] sectionCloseChar: The character(s) closing section declarations.
     /// @throws std::bad_alloc
+    /// @version 2026-10-18/GGB - Added sectionOpenChar and sectionCloseChar.
     /// @version    2020-11-30/GGB - Changed to use std::filesystem
     /// @version 2020-04-27/GGB - Function created.
 
-    CReaderCore(std::filesystem::path const &filename, std::string seperatorChar = "=", std::string commentChar = "#")
-      : filename_(filename), seperatorChar_(seperatorChar), commentChar_(commentChar)
+    CReaderCore(std::filesystem::path const &filename, std::string seperatorChar = "=", std::string commentChar = "#",
+                std::string sectionOpenChar = "", std::string sectionCloseChar = "")
+      : filename_(filename), seperatorChar_(seperatorChar), commentChar_(commentChar), sectionOpenChar_(sectionOpenChar),
+        sectionCloseChar_(sectionCloseChar)
+    {
+    }
+
+    /// @brief      Destructor. Stops the watch thread.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Stop watching the file.
+
+    virtual ~CReaderCore()
+    {
+      stopWatching();
+    }
+
+    /// @brief      Reads the file again and publishes the new values. The change callbacks are called for each tag that was
+    ///             added, changed or removed. Lookups in other threads are not blocked.
+    /// @throws     GCL::runtime_error - Unable to open the file. The current values are kept.
+    /// @throws     std::bad_alloc
+    /// @note       Callbacks are called in the thread calling reload(), (The watch thread if watching) in the order of the
+    ///             reloads and without reloadMutex_ locked. A callback may call the layer functions and reload(). The changes
+    ///             are then notified before the callback returns. A callback must not call stopWatching().
+    /// @version    2026-10-18/GGB - Callbacks are called after reloadMutex_ is released.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void reload()
+    {
+      std::lock_guard<std::recursive_mutex> notifyLock(notifyMutex_);
+      std::shared_ptr<CKeyStore const> oldSnapshot;
+      std::shared_ptr<CKeyStore const> newSnapshot;
+
+      snapshot();     // Load the file if this is the first use.
+
+      {
+        std::lock_guard<std::mutex> lock(reloadMutex_);
+
+        fileValues_ = readFile();
+        oldSnapshot = publish(applyLayers(fileValues_));
+        newSnapshot = snapshotOwner_;
+      }
+
+      notifyChanges(*oldSnapshot, *newSnapshot);
+    }
+
+    /// @brief      Sets the default value of a tag. The default is used if the tag is not in the file or any other layer. If the
+    ///             default is set more than once, the last value is used.
+    /// @param[in]  tagName: The name of the tag. (eg "section/tag" for files with sections)
+    /// @param[in]  value: The default value.
+    /// @throws     std::bad_alloc
+    /// @note       If the file has already been loaded, the layers are merged again. (See layersChanged())
+    /// @version    2026-10-18/GGB - Applied immediately if the file has already been loaded. (Was applied at the next reload)
+    /// @version    2026-10-18/GGB - Function created.
+
+    void setDefault(std::string_view tagName, std::string_view value)
+    {
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+
+      {
+        std::lock_guard<std::mutex> lock(reloadMutex_);
+
+        defaults_.push_back(SLayerValue{std::string(sectionTag.first), std::string(sectionTag.second), std::string(value)});
+      }
+
+      layersChanged();
+    }
+
+    /// @brief      Sets the prefix of the environment variables that override values. See readEnvironment() for the names. The
+    ///             environment is read each time the file is loaded.
+    /// @param[in]  prefix: The prefix. (eg "MYAPP" for MYAPP_SECTION__TAG) An empty prefix stops environment variables being used.
+    /// @throws     std::bad_alloc
+    /// @note       If the file has already been loaded, the layers are merged again. (See layersChanged())
+    /// @version    2026-10-18/GGB - Applied immediately if the file has already been loaded. (Was applied at the next reload)
+    /// @version    2026-10-18/GGB - Function created.
+
+    void setEnvironmentPrefix(std::string prefix)
+    {
+      {
+        std::lock_guard<std::mutex> lock(reloadMutex_);
+
+        environmentPrefix_ = std::move(prefix);
+      }
+
+      layersChanged();
+    }
+
+    /// @brief      Sets the values that are overridden by the command line. Arguments of the form "--section/tag=value" (or
+    ///             "--tag=value" for files without sections) are used and all other arguments are ignored. Arguments after "--"
+    ///             are ignored. If a tag is given more than once, the last value is used.
+    /// @param[in]  argc: The number of arguments.
+    /// @param[in]  argv: The arguments. argv[0] is the program name and is ignored.
+    /// @throws     std::bad_alloc
+    /// @note       If the file has already been loaded, the layers are merged again. (See layersChanged())
+    /// @version    2026-10-18/GGB - Applied immediately if the file has already been loaded. (Was applied at the next reload)
+    /// @version    2026-10-18/GGB - Function created.
+
+    void setCommandLine(int argc, char const *const *argv)
+    {
+      std::vector<SLayerValue> commandLine;
+      bool endOfOptions = false;
+
+      for (int index = 1; (index < argc) && !endOfOptions; ++index)
+      {
+        std::string_view argument(argv[index]);
+        std::size_t equals;
+
+        if (argument == "--")
+        {
+          endOfOptions = true;
+        }
+        else if ( (argument.substr(0, 2) == "--") && ((equals = argument.find('=')) != std::string_view::npos) && (equals > 2) )
+        {
+          std::pair<std::string_view, std::string_view> sectionTag = splitTagName(argument.substr(2, equals - 2));
+
+          if (!sectionTag.second.empty())
+          {
+            commandLine.push_back(SLayerValue{std::string(sectionTag.first), std::string(sectionTag.second),
+                                              std::string(argument.substr(equals + 1))});
+          };
+        };
+      };
+
+      {
+        std::lock_guard<std::mutex> lock(reloadMutex_);
+
+        commandLine_ = std::move(commandLine);
+      }
+
+      layersChanged();
+    }
+
+    /// @brief      Returns where the value of a tag came from. For values from files this is the file and line. Values from the
+    ///             layers have the file "<default>", "<environment>" or "<command line>" and line 0.
+    /// @param[in]  tagName: The name of the tag. Passed to splitTagName().
+    /// @returns    The location if the tag was found and the location is known. (Values read from the binary cache have no
+    ///             location)
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Return the file name as a string, as the snapshot may be freed by a reload.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::optional<STagLocation> tagLocation(std::string_view tagName)
+    {
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+
+      return location(sectionTag.first, sectionTag.second);
+    }
+
+    /// @brief      Adds a callback that is called when a value changes after a reload.
+    /// @param[in]  section: The section to watch. An empty string matches all sections.
+    /// @param[in]  tagName: The tag to watch. An empty string matches all tags in the section.
+    /// @param[in]  callback: Called with the section, tag and new value. The value is empty if the tag was removed.
+    /// @returns    The ID of the callback. Used with removeChangeCallback().
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::size_t addChangeCallback(std::string section, std::string tagName, changeCallback_t callback)
+    {
+      std::lock_guard<std::mutex> lock(callbackMutex_);
+      std::size_t returnValue = nextCallbackID_++;
+
+      callbacks_.push_back(SChangeCallback{returnValue, std::move(section), std::move(tagName), std::move(callback)});
+
+      return returnValue;
+    }
+
+    /// @brief      Removes a change callback.
+    /// @param[in]  callbackID: The value returned by addChangeCallback().
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void removeChangeCallback(std::size_t callbackID)
+    {
+      std::lock_guard<std::mutex> lock(callbackMutex_);
+
+      callbacks_.erase(std::remove_if(callbacks_.begin(), callbacks_.end(), [callbackID](SChangeCallback const &cb)
+                                      {
+                                        return cb.callbackID == callbackID;
+                                      }), callbacks_.end());
+    }
+
+    /// @brief      Starts a background thread that reloads the file when it changes. Does nothing if already watching.
+    /// @throws     GCL::runtime_error - Unable to open or watch the file.
+    /// @note       On Linux the directory of the file is watched with inotify, so files that are replaced (rename) as well as
+    ///             files that are written are detected. On other platforms the modification time is checked every second.
+    /// @version    2026-10-18/GGB - Function created.
+
+    void startWatching()
+    {
+      snapshot();     // Load the file if this is the first use.
+
+      if (!watchThread_.joinable())
+      {
+#if defined(__linux__)
+        std::filesystem::path directory = filename_.parent_path();
+
+        if (directory.empty())
+        {
+          directory = ".";
+        };
+
+        if ((inotifyFD_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) < 0)
+        {
+          RUNTIME_ERROR(boost::locale::translate("Unable to watch configuration file."));
+        }
+        else if ( (inotify_add_watch(inotifyFD_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) ||
+                  (pipe(stopPipe_) < 0) )
+        {
+          close(inotifyFD_);
+          inotifyFD_ = -1;
+          RUNTIME_ERROR(boost::locale::translate("Unable to watch configuration file."));
+        };
+#else
+        stopWatch_ = false;
+#endif
+        watchThread_ = std::thread(&CReaderCore::watchFile, this);
+      };
+    }
+
+    /// @brief      Stops the watch thread and waits for it to finish. Does nothing if not watching.
+    /// @throws     None.
+    /// @note       Must not be called from a change callback, as the callback may be running in the watch thread.
+    /// @version    2026-10-18/GGB - Always join the thread. (It was detached if the stop byte could not be written)
+    /// @version    2026-10-18/GGB - Function created.
+
+    void stopWatching() noexcept
     {
+      if (watchThread_.joinable())
+      {
+#if defined(__linux__)
+        char stop = 0;
+
+        ssize_t written;
+
+        do
+        {
+          written = write(stopPipe_[1], &stop, 1);
+        }
+        while ((written < 0) && (errno == EINTR));
+
+          // Closing the write end also wakes the thread (POLLHUP), so it stops even if the write failed.
+
+        close(stopPipe_[1]);
+        watchThread_.join();
+
+        close(inotifyFD_);
+        close(stopPipe_[0]);
+        inotifyFD_ = stopPipe_[0] = stopPipe_[1] = -1;
+#else
+        {
+          std::lock_guard<std::mutex> lock(watchMutex_);
+
+          stopWatch_ = true;
+        }
+        stopCondition_.notify_all();
+        watchThread_.join();
+#endif
+      };
     }
 
-    virtual ~CReaderCore() {}
+    /// @brief      Returns true if the file is being watched.
+    /// @returns    true if watching.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    bool watching() const noexcept
+    {
+      return watchThread_.joinable();
+    }
 
     /// @brief Returns a tag value.
     /// @param[in] tagName: The name of the tag to find.
@@ -200,55 +1917,140 @@ namespace GCL
 
     virtual std::optional<double> tagValueDouble(std::string const &tagName)
     {
-      std::optional<double> returnValue;
-
-      std::optional<std::string> value = readTag(tagName);
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
 
-      if (value)
-      {
-        returnValue = string2Double(*value);
-      };
-
-      return returnValue;
+      return convertedValue<double>(sectionTag.first, sectionTag.second, CKeyStore::CONVERT_DOUBLE,
+                                [this](std::string_view s) { return string2Double(s); });
     }
 
     /// @brief Returns an uint16 tag value.
     /// @param[in] tagName: The name of the tag to find.
     /// @returns A std::optional containing the data (if found and converted) A false optional implies the tag could was no found.
-    /// @throws std::runtime_error - The value was not able to be converted.
-    /// @throws std::out_of_range - The value was too large for the type.
+    /// @throws std::runtime_error - The value was not able to be converted, or was too large for the type.
     /// @version 2020-04-27/GGB - Function created.
 
     virtual std::optional<std::uint16_t> tagValueUInt16(std::string const &tagName)
     {
-      std::optional<std::uint16_t> returnValue;
-
-      std::optional<std::string> value = readTag(tagName);
-
-      if (value)
-      {
-        returnValue = string2UInt16(*value);
-      };
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
 
-      return returnValue;
+      return convertedValue<std::uint16_t>(sectionTag.first, sectionTag.second, CKeyStore::CONVERT_UINT16,
+                                [this](std::string_view s) { return string2UInt16(s); });
     }
 
     /// @brief Returns an int32 tag value.
     /// @param[in] tagName: The name of the tag to find.
     /// @returns A std::optional containing the data (if found and converted) A false optional implies the tag could was no found.
-    /// @throws std::runtime_error - The value was not able to be converted.
-    /// @throws std::out_of_range - The value was too large for the type.
+    /// @throws std::runtime_error - The value was not able to be converted, or was too large for the type.
     /// @version 2020-04-27/GGB - Function created.
 
     virtual std::optional<std::int32_t> tagValueInt32(std::string const &tagName)
     {
-      std::optional<std::int32_t> returnValue;
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+
+      return convertedValue<std::int32_t>(sectionTag.first, sectionTag.second, CKeyStore::CONVERT_INT32,
+                                [this](std::string_view s) { return string2Int32(s); });
+    }
+
+    /// @brief      Returns an int64 tag value.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::optional<std::int64_t> tagValueInt64(std::string const &tagName)
+    {
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+
+      return convertedValue<std::int64_t>(sectionTag.first, sectionTag.second, CKeyStore::CONVERT_INT64,
+                                [this](std::string_view s) { return string2Int64(s); });
+    }
+
+    /// @brief      Returns a uint64 tag value.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::optional<std::uint64_t> tagValueUInt64(std::string const &tagName)
+    {
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+
+      return convertedValue<std::uint64_t>(sectionTag.first, sectionTag.second, CKeyStore::CONVERT_UINT64,
+                                [this](std::string_view s) { return string2UInt64(s); });
+    }
+
+    /// @brief      Returns a bool tag value.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::optional<bool> tagValueBool(std::string const &tagName)
+    {
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+
+      return convertedValue<bool>(sectionTag.first, sectionTag.second, CKeyStore::CONVERT_BOOL,
+                                [this](std::string_view s) { return string2Bool(s); });
+    }
+
+    /// @brief      Returns a duration tag value. See string2Duration() for the format.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::optional<std::chrono::nanoseconds> tagValueDuration(std::string const &tagName)
+    {
+      std::optional<std::chrono::nanoseconds> returnValue;
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+
+        // The count is cached, as the cache only stores plain values.
+
+      std::optional<std::int64_t> count = convertedValue<std::int64_t>(sectionTag.first, sectionTag.second,
+                                                                        CKeyStore::CONVERT_DURATION, [this](std::string_view s)
+                                                                        {
+                                                                          return string2Duration(s).count();
+                                                                        });
+
+      if (count)
+      {
+        returnValue = std::chrono::nanoseconds(*count);
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Returns a size in bytes. See string2ByteSize() for the format.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::optional<std::uint64_t> tagValueByteSize(std::string const &tagName)
+    {
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
 
-      std::optional<std::string> value = readTag(tagName);
+      return convertedValue<std::uint64_t>(sectionTag.first, sectionTag.second, CKeyStore::CONVERT_BYTESIZE,
+                                [this](std::string_view s) { return string2ByteSize(s); });
+    }
+
+    /// @brief      Returns a list tag value. eg "a, b, c"
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @param[in]  seperator: The character seperating the items.
+    /// @returns    A std::optional containing the items (if found)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    virtual std::optional<std::vector<std::string>> tagValueList(std::string const &tagName, char seperator = ',')
+    {
+      std::optional<std::vector<std::string>> returnValue;
+      std::pair<std::string_view, std::string_view> sectionTag = splitTagName(tagName);
+      CSnapshotGuard values = snapshot();
+      std::optional<std::string_view> value = values->find(sectionTag.first, sectionTag.second);
 
       if (value)
       {
-        returnValue = string2Int32(*value);
+        returnValue = string2List(*value, seperator);
       };
 
       return returnValue;
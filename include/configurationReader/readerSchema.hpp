@@ -0,0 +1,443 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                configurationReader/readerSchema.hpp
+// SUBSYSTEM:           Configuration file reader
+// LANGUAGE:						C++
+// TARGET OS:						None.
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Schema of a configuration file that is loaded into a structure.
+//
+// CLASSES INCLUDED:    CSchemaField
+//                      CConfigurationSchema
+//
+// HISTORY:             2026-10-18 GGB - File Created
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_READERSCHEMA_HPP
+#define GCL_READERSCHEMA_HPP
+
+  // Standard C++ library header files
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+  // Miscellaneous library header files
+
+#include <boost/locale.hpp>
+
+  // GCL library header files.
+
+#include "include/error.h"
+#include "include/configurationReader/readerCore.hpp"
+
+namespace GCL
+{
+  namespace schema
+  {
+    template<typename T>
+    struct isDuration : std::false_type {};
+
+    template<typename Rep, typename Period>
+    struct isDuration<std::chrono::duration<Rep, Period>> : std::true_type {};
+
+    template<typename T>
+    struct isOptional : std::false_type
+    {
+      using value_type = T;
+    };
+
+    template<typename T>
+    struct isOptional<std::optional<T>> : std::true_type
+    {
+      using value_type = T;
+    };
+  } // namespace schema
+
+  /// @details  One field of a configuration schema. Connects a tag in the configuration file to a member of the structure the
+  ///           configuration is loaded into. The conversion is chosen from the type of the member.
+  ///           Supported types - std::string, bool, integer types, floating point types, std::chrono::duration,
+  ///           std::vector<std::string> (a list) and std::optional of any of these.
+  ///           A field is required unless it has a default value or the member is a std::optional.
+  ///           Fields are created with schemaField() and configured with defaultValue(), range(), byteSize() and seperator().
+  /// @tparam   S: The structure the configuration is loaded into.
+  /// @tparam   T: The type of the member.
+
+  template<typename S, typename T>
+  class CSchemaField
+  {
+  public:
+    using struct_type = S;
+    using value_type = typename schema::isOptional<T>::value_type;
+
+    static_assert(std::is_same_v<value_type, std::string> || std::is_same_v<value_type, std::vector<std::string>> ||
+                  std::is_arithmetic_v<value_type> || schema::isDuration<value_type>::value,
+                  "The type of the member is not supported by the configuration schema.");
+
+  private:
+    std::string tagName_;                                   ///< The name of the tag. (eg "section/tag")
+    T S::*member_;                                          ///< The member the value is stored in.
+    std::optional<value_type> defaultValue_;                ///< Used if the tag is not in the file.
+    std::optional<std::pair<value_type, value_type>> range_; ///< The minimum and maximum values.
+    bool byteSize_ = false;                                 ///< The value is a byte size. (eg 64MB)
+    char seperator_ = ',';                                  ///< The seperator of list values.
+
+    /// @brief      Returns the source location of the tag for error messages.
+    /// @param[in]  reader: The configuration reader.
+    /// @returns    " (file:line)", or an empty string if the location is not known.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::string location(CReaderCore &reader) const
+    {
+      std::string returnValue;
+      std::optional<CReaderCore::STagLocation> sourceLocation = reader.tagLocation(tagName_);
+
+      if (sourceLocation)
+      {
+        returnValue = " (" + std::string(sourceLocation->file) + ":" + std::to_string(sourceLocation->line) + ")";
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Reads and converts the value of the tag.
+    /// @param[in]  reader: The configuration reader.
+    /// @returns    The value, if the tag was found.
+    /// @throws     std::runtime_error - The value was not able to be converted, or is out of range for the type.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::optional<value_type> readValue(CReaderCore &reader) const
+    {
+      std::optional<value_type> returnValue;
+
+      if constexpr (std::is_same_v<value_type, std::string>)
+      {
+        returnValue = reader.tagValueString(tagName_);
+      }
+      else if constexpr (std::is_same_v<value_type, std::vector<std::string>>)
+      {
+        returnValue = reader.tagValueList(tagName_, seperator_);
+      }
+      else if constexpr (std::is_same_v<value_type, bool>)
+      {
+        returnValue = reader.tagValueBool(tagName_);
+      }
+      else if constexpr (schema::isDuration<value_type>::value)
+      {
+        std::optional<std::chrono::nanoseconds> value = reader.tagValueDuration(tagName_);
+
+        if (value)
+        {
+          returnValue = std::chrono::duration_cast<value_type>(*value);
+        };
+      }
+      else if constexpr (std::is_floating_point_v<value_type>)
+      {
+        std::optional<double> value = reader.tagValueDouble(tagName_);
+
+        if (value)
+        {
+          returnValue = static_cast<value_type>(*value);
+        };
+      }
+      else if constexpr (std::is_signed_v<value_type>)
+      {
+        std::optional<std::int64_t> value = reader.tagValueInt64(tagName_);
+
+        if (value)
+        {
+          if ( (*value < std::numeric_limits<value_type>::min()) || (*value > std::numeric_limits<value_type>::max()) )
+          {
+            throw std::runtime_error("Tag value is too large for the type" + location(reader));
+          };
+          returnValue = static_cast<value_type>(*value);
+        };
+      }
+      else
+      {
+        std::optional<std::uint64_t> value = byteSize_ ? reader.tagValueByteSize(tagName_) : reader.tagValueUInt64(tagName_);
+
+        if (value)
+        {
+          if (*value > std::numeric_limits<value_type>::max())
+          {
+            throw std::runtime_error("Tag value is too large for the type" + location(reader));
+          };
+          returnValue = static_cast<value_type>(*value);
+        };
+      };
+
+      return returnValue;
+    }
+
+  public:
+    /// @brief      Constructor for the class. Use schemaField() to create fields.
+    /// @param[in]  tagName: The name of the tag. (eg "section/tag" for CReaderSections)
+    /// @param[in]  member: The member the value is stored in.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    CSchemaField(std::string tagName, T S::*member) : tagName_(std::move(tagName)), member_(member) {}
+
+    /// @brief      Sets the value used if the tag is not in the file. Fields with a default value are not required.
+    /// @param[in]  value: The default value.
+    /// @returns    The field.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    CSchemaField &&defaultValue(value_type value) &&
+    {
+      defaultValue_ = std::move(value);
+      return std::move(*this);
+    }
+
+    /// @brief      Sets the range of the value. Values outside the range are errors. The default value is not checked.
+    /// @param[in]  minimum: The minimum value.
+    /// @param[in]  maximum: The maximum value.
+    /// @returns    The field.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    CSchemaField &&range(value_type minimum, value_type maximum) &&
+    {
+      static_assert(std::is_arithmetic_v<value_type> || schema::isDuration<value_type>::value,
+                    "A range can only be used with numbers and durations.");
+
+      range_ = std::make_pair(minimum, maximum);
+      return std::move(*this);
+    }
+
+    /// @brief      The value is a size in bytes. See CReaderCore::string2ByteSize() for the format.
+    /// @returns    The field.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    CSchemaField &&byteSize() &&
+    {
+      static_assert(std::is_integral_v<value_type> && std::is_unsigned_v<value_type> && !std::is_same_v<value_type, bool>,
+                    "A byte size must be an unsigned integer.");
+
+      byteSize_ = true;
+      return std::move(*this);
+    }
+
+    /// @brief      Sets the seperator of the items in a list.
+    /// @param[in]  seperator: The seperator.
+    /// @returns    The field.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    CSchemaField &&seperator(char seperator) &&
+    {
+      static_assert(std::is_same_v<value_type, std::vector<std::string>>, "A seperator can only be used with lists.");
+
+      seperator_ = seperator;
+      return std::move(*this);
+    }
+
+    /// @brief      Returns the name of the tag.
+    /// @returns    The name of the tag.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::string const &tagName() const noexcept
+    {
+      return tagName_;
+    }
+
+    /// @brief      Reads the value of the field and stores it in the structure. Errors are added to the list of errors and the
+    ///             member is not changed.
+    /// @param[in]  reader: The configuration reader.
+    /// @param[out] object: The structure to store the value in.
+    /// @param[out] errors: The errors found.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    void load(CReaderCore &reader, S &object, std::vector<std::string> &errors) const
+    {
+      try
+      {
+        std::optional<value_type> value = readValue(reader);
+        bool fromFile = value.has_value();
+
+        if (!value)
+        {
+          value = defaultValue_;
+        };
+
+        if (!value)
+        {
+          if constexpr (schema::isOptional<T>::value)
+          {
+            object.*member_ = std::nullopt;
+          }
+          else
+          {
+            errors.push_back(tagName_ + ": " + boost::locale::translate("Required tag not found.").str());
+          };
+        }
+        else if (fromFile && range_ && ((*value < range_->first) || (range_->second < *value)))
+        {
+          errors.push_back(tagName_ + ": " + boost::locale::translate("Value out of range.").str() + location(reader));
+        }
+        else
+        {
+          object.*member_ = std::move(*value);
+        };
+      }
+      catch(GCL::runtime_error const &)
+      {
+        throw;
+      }
+      catch(std::runtime_error const &e)
+      {
+        errors.push_back(tagName_ + ": " + e.what());
+      };
+    }
+  };
+
+  /// @brief      Creates a field of a configuration schema.
+  /// @param[in]  tagName: The name of the tag. (eg "section/tag" for CReaderSections)
+  /// @param[in]  member: The member the value is stored in. (eg &SConfig::port)
+  /// @returns    The field.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  template<typename S, typename T>
+  CSchemaField<S, T> schemaField(std::string tagName, T S::*member)
+  {
+    return CSchemaField<S, T>(std::move(tagName), member);
+  }
+
+  /// @details  Declares the tags of a configuration file and the members of a structure they are stored in. load() reads all the
+  ///           tags once, checks them and returns the filled structure. The structure is a plain value, so code that uses the
+  ///           configuration reads members directly instead of looking up tags. All errors are reported together.
+  ///           To follow changes to the file, call load() again from a change callback. (See CReaderCore::addChangeCallback())
+  ///           @code
+  ///           struct SServerConfig
+  ///           {
+  ///             std::string host;
+  ///             std::uint16_t port;
+  ///             std::chrono::milliseconds timeout;
+  ///             std::optional<std::string> logFile;
+  ///           };
+  ///
+  ///           static auto const serverSchema = GCL::configurationSchema<SServerConfig>(
+  ///             GCL::schemaField("server/host", &SServerConfig::host).defaultValue("localhost"),
+  ///             GCL::schemaField("server/port", &SServerConfig::port).range(1, 65535),
+  ///             GCL::schemaField("server/timeout", &SServerConfig::timeout).defaultValue(std::chrono::seconds(5)),
+  ///             GCL::schemaField("server/logfile", &SServerConfig::logFile));
+  ///
+  ///           SServerConfig config = serverSchema.load(reader);
+  ///           @endcode
+  /// @tparam   S: The structure the configuration is loaded into. Must be default constructible.
+  /// @tparam   Fields: The CSchemaField types.
+
+  template<typename S, typename... Fields>
+  class CConfigurationSchema
+  {
+  private:
+    std::tuple<Fields...> fields_;
+
+  public:
+    /// @brief      Constructor for the class. Use configurationSchema() to create schemas.
+    /// @param[in]  fields: The fields.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    explicit CConfigurationSchema(Fields... fields) : fields_(std::move(fields)...) {}
+
+    /// @brief      Loads the configuration into an existing structure. Members that do not have errors are updated.
+    /// @param[in]  reader: The configuration reader.
+    /// @param[out] object: The structure to load the values into.
+    /// @throws     GCL::runtime_error - Unable to open the file, or one or more fields have errors. The message lists all the
+    ///             errors, one on each line.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    void load(CReaderCore &reader, S &object) const
+    {
+      std::vector<std::string> errors;
+
+      std::apply([&](Fields const &... field)
+      {
+        (field.load(reader, object, errors), ...);
+      }, fields_);
+
+      if (!errors.empty())
+      {
+        std::string message = boost::locale::translate("Configuration errors.").str();
+
+        for (std::string const &error : errors)
+        {
+          message += "\n" + error;
+        };
+
+        RUNTIME_ERROR(message);
+      };
+    }
+
+    /// @brief      Loads the configuration into a new structure.
+    /// @param[in]  reader: The configuration reader.
+    /// @returns    The structure.
+    /// @throws     GCL::runtime_error - Unable to open the file, or one or more fields have errors.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
+
+    S load(CReaderCore &reader) const
+    {
+      S returnValue{};
+
+      load(reader, returnValue);
+
+      return returnValue;
+    }
+  };
+
+  /// @brief      Creates a configuration schema.
+  /// @tparam     S: The structure the configuration is loaded into.
+  /// @param[in]  fields: The fields. (See schemaField())
+  /// @returns    The schema.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  template<typename S, typename... Fields>
+  CConfigurationSchema<S, Fields...> configurationSchema(Fields... fields)
+  {
+    static_assert((std::is_same_v<typename Fields::struct_type, S> && ...), "All the fields must be members of S.");
+
+    return CConfigurationSchema<S, Fields...>(std::move(fields)...);
+  }
+
+} // namespace GCL
+
+#endif // GCL_READERSCHEMA_HPP
@@ -27,7 +27,15 @@
 //
 // CLASSES INCLUDED:
 //
-// HISTORY:             2020-04-28 GGB - File Created
+// HISTORY:             2026-10-18 GGB - Added tagLocation(section, tag).
+//                      2026-10-18 GGB - Added binaryCache.
+//                      2026-10-18 GGB - Parsing, reloading and watching moved to CReaderCore.
+//                      2026-10-18 GGB - Lookups are thread safe. Lazy loading parses the whole file on the first lookup.
+//                      2026-10-18 GGB - Values are published as snapshots. Added file watching and change callbacks.
+//                      2026-10-18 GGB - Cached conversions. Added bool, int64, uint64, duration, byte size and list values.
+//                      2026-10-18 GGB - Eager loading uses CKeyStore. Added std::string_view overloads.
+//                      2026-10-18 GGB - Added eager loading of the file into an index in a single pass.
+//                      2020-04-28 GGB - File Created
 //
 //*********************************************************************************************************************************
 
@@ -36,24 +44,19 @@
 
   // Standard C++ library header files
 
+#include <chrono>
 #include <cstdint>
-#include <exception>
 #include <filesystem>
 #include <optional>
 #include <string>
-#include <unordered_map>
-
-  // Miscellaneous library header files
-
-#include <boost/algorithm/string.hpp>
-#include <boost/lexical_cast.hpp>
-#include <boost/locale.hpp>
+#include <string_view>
+#include <utility>
+#include <vector>
 
   // GCL library header files.
 
-#include "include/error.h"
+#include "include/configurationReader/keyStore.hpp"
 #include "include/configurationReader/readerCore.hpp"
-#include "include/logger/loggerCore.h"
 
 namespace GCL
 {
@@ -67,21 +70,20 @@ namespace GCL
   ///           applications generally startup and run automatically while serving requests. (Servers, daemons etc) While it is
   ///           possible to implement/add methods for updating these files, if frequent parameter changes are required an settings
   ///           file that is designed for frequent changes and updates may be a better option.
-  ///           The approach used to reading values is that values are read from the file they are stored in a map for later
-  ///           retrieval. As the type of the value is unknown when read, the values are initially stored as strings.
-  ///           Comments - Must always appear on line by themselves and the first non-white space character on the line must be
-  ///                      the comment character.
+  ///           As the type of a value is unknown when the file is read, the values are stored as strings and converted when they
+  ///           are requested.
+  ///           Comments - Start with the comment character. Everything after the comment character on a line is ignored.
+  ///           Loading, reloading, watching and thread safety are provided by CReaderCore.
+  ///           The (section, tag) overloads take std::string_view and do not build the combined "section/tag" name.
+  ///           tagValueView() returns the value without copying it.
+  ///           Files can be split with include and include_dir lines. (See CReaderCore)
+  ///             include common.ini
+  ///             include_dir hosts.d
 
   class CReaderSections : public CReaderCore
   {
   private:
-    using tagValueContainer_t = std::unordered_map<std::string, std::string>;
-    using sectionContainer_t = std::unordered_map<std::string, tagValueContainer_t>;
-
-    std::string sectionOpenChar_;               ///< The seperator character to use to open section declarations.
-    std::string sectionCloseChar_;              ///< The seperator character to use to close section declarations.
     std::string namespaceChar_;                 ///< The seperator character to use to seperate namespace tag combinations.
-    sectionContainer_t sectionContainer;        ///< The container storing the section values and data.
 
     CReaderSections() = delete;
     CReaderSections(CReaderSections const &) = delete;
@@ -90,249 +92,272 @@ namespace GCL
 
   protected:
 
-    /// @brief Reads the configuration file until the tag value is found.
-    /// @param[in] sectionTagName: The section and tag seperated by a namespace seperator.
-    /// @returns Standard optional with the value if found. If the tag is not found then the optional has no value.
-    /// @throws
-    /// @version 2020-11-30/GGB - Debugging function.
-    /// @version 2020-04-27/GGB - Function created.
+    /// @brief      Splits a "section/tag" name into the section and tag.
+    /// @param[in]  sectionTagName: The section and tag seperated by a namespace seperator.
+    /// @returns    The section and the tag.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
 
-    virtual std::optional<std::string> readTag(std::string const &sectionTagName)
+    virtual std::pair<std::string_view, std::string_view> splitTagName(std::string_view sectionTagName) const noexcept override
     {
-      std::optional<std::string> returnValue;
-      std::size_t lineNumber = 0;
-      std::size_t linesRead = 0;  // Used for readahead.
-      std::string szLine, szSection;
-      std::size_t linesReadAhead = readAhead_;
-      bool readAheadComplete = false;
-      bool sectionFound = false, tagFound = false;
-      sectionContainer_t::iterator sectionIterator;
-      tagValueContainer_t::iterator tagIterator;
-      std::string section, tagName;
+      std::size_t seperator = sectionTagName.find(namespaceChar_);
+      std::string_view tagName;
 
-      section = sectionTagName.substr(0, sectionTagName.find(namespaceChar_, 0));
-      tagName = sectionTagName.substr(sectionTagName.find(namespaceChar_, 0) + 1, std::string::npos);
-
-      boost::trim(section);
-      boost::trim(tagName);
+      if (seperator != std::string_view::npos)
+      {
+        tagName = trimView(sectionTagName.substr(seperator + namespaceChar_.size()));
+      };
 
-      logger::TRACEMESSAGE("READERSECTIONS: Searching for section: " + section + " tag: " + tagName);
+      return {trimView(sectionTagName.substr(0, seperator)), tagName};
+    }
 
-        // Has the section been loaded?
+  public:
+    using CReaderCore::tagValueBool;
+    using CReaderCore::tagValueByteSize;
+    using CReaderCore::tagValueDouble;
+    using CReaderCore::tagValueDuration;
+    using CReaderCore::tagValueInt32;
+    using CReaderCore::tagValueInt64;
+    using CReaderCore::tagValueList;
+    using CReaderCore::tagValueString;
+    using CReaderCore::tagValueUInt16;
+    using CReaderCore::tagValueUInt64;
+    using CReaderCore::tagLocation;
 
-      sectionIterator = sectionContainer.find(section);
-      if (sectionIterator != sectionContainer.end())
-      {
-          // Have already got the section in memory.
+    /// @brief      Constructor for the class. A single constructor is provided and the default constructor is deleted.
+    /// @param[in]  filename: The filename and path of the configuration file.
+    /// @param[in]  seperatorChar: The character(s) used for seperating statements.
+    /// @param[in]  commentChar: The character(s) used for indicating comments.
+    /// @param[in]  eagerLoad: true - Load the file now. false - Load the file on the first lookup.
+    /// @param[in]  binaryCache: true - Use a binary cache file. (filename + ".cache")
+    /// @throws     std::bad_alloc
+    /// @throws     GCL::runtime_error - Unable to open the file. (eagerLoad only)
+    /// @version    2026-10-18/GGB - Added binaryCache.
+    /// @version    2026-10-18/GGB - The section characters are passed to CReaderCore.
+    /// @version    2026-10-18/GGB - Added eagerLoad.
+    /// @version    2020-11-30/GGB - Changed to suse std::filesystem.
+    /// @version    2020-04-27/GGB - Function created.
 
-        tagIterator = sectionIterator->second.find(tagName);
-        if (tagIterator != sectionIterator->second.end())
-        {
-            // Have already got the value in memory. If the tag has not been read then it does not exist in the file.
+    CReaderSections(std::filesystem::path const &filename, std::string seperatorChar = "=", std::string commentChar = "#",
+                    bool eagerLoad = false, bool binaryCache = false)
+      :  CReaderCore(filename, seperatorChar, commentChar, "[", "]"), namespaceChar_("/")
+    {
+      binaryCache_ = binaryCache;
 
-          returnValue = (tagIterator->second);
-        };
-      }
-      else
+      if (eagerLoad)
       {
+        loadFile();
+      };
+    }
 
-          // Section::Tag pair not found yet, read from the file.
-
-        std::ifstream ifs(filename_);
+    /// @brief      Destructor. Stops the watch thread before the derived class is destroyed, as callbacks may use it.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Stop watching the file.
 
-        if (!ifs.is_open())
-        {
-          RUNTIME_ERROR(boost::locale::translate("Unable to open configuration file."));
-        };
+    virtual ~CReaderSections()
+    {
+      stopWatching();
+    }
 
-          // Read through the already read lines quickly without any translation.
-
-        while (lineNumber < lastLine_)
-        {
-          std::getline(ifs, szLine);
-          lineNumber++;
-        };
-
-          // Now start reading sections and tags until we find the value we are looking for.
-
-        while (!ifs.eof() && !readAheadComplete)
-        {
-          std::getline(ifs, szLine);
+    /// @brief      Returns a view of a tag value without copying it.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found) The view keeps the values it was read from alive, so it is
+    ///             valid after the file is reloaded.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @version    2026-10-18/GGB - Return a CValueView that owns the snapshot.
+    /// @version    2026-10-18/GGB - Function created.
 
-          boost::trim(szLine);  // Drop of all whitespace
+    std::optional<CValueView> tagValueView(std::string_view section, std::string_view tagName)
+    {
+      return valueView(section, tagName);
+    }
 
-          linesRead++;
-          lineNumber++;
+    /// @brief      Returns where the value of a tag came from. See CReaderCore::tagLocation().
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    The location if the tag was found and the location is known.
+    /// @throws     GCL::runtime_error - Unable to open the file.
+    /// @version    2026-10-18/GGB - Return the file name as a string.
+    /// @version    2026-10-18/GGB - Function created.
 
-          if (!szLine.empty())
-          {
-            std::size_t indexStart, indexEnd;
+    std::optional<STagLocation> tagLocation(std::string_view section, std::string_view tagName)
+    {
+      return location(section, tagName);
+    }
 
-              // Check if a comment, section or tag line
+    /// @brief      Returns a tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found)
+    /// @throws
+    /// @version    2026-10-18/GGB - Changed to std::string_view. Search the key store directly if the file was loaded eagerly.
+    /// @version    2020-04-27/GGB - Function created.
 
-            if ((indexStart = szLine.find(commentChar_)) != std::string::npos)
-            {
-                // Comment in line, discard everything after the comment.
+    virtual std::optional<std::string> tagValueString(std::string_view section, std::string_view tagName)
+    {
+      std::optional<std::string> returnValue;
+      CSnapshotGuard values = snapshot();
+      std::optional<std::string_view> value = values->find(section, tagName);
 
-              szLine = szLine.substr(0, indexStart);
+      if (value)
+      {
+        returnValue = std::string(*value);
+      };
 
-              logger::TRACEMESSAGE("Line after removing comments: " + szLine);
-            };
+      return returnValue;
+    }
 
-            if ((indexStart = szLine.find(sectionOpenChar_)) != std::string::npos)
-            {
-                // Section line.
+    /// @brief      Returns a double tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag could was no
+    ///             found.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Converted values are cached.
+    /// @version    2026-10-18/GGB - Changed to std::string_view.
+    /// @version    2020-04-27/GGB - Function created.
 
-              if (linesReadAhead == 0)
-              {
-                readAheadComplete = true;
-              }
-              else
-              {
-                indexEnd = szLine.find(sectionCloseChar_);
+    virtual std::optional<double> tagValueDouble(std::string_view section, std::string_view tagName)
+    {
+      return convertedValue<double>(section, tagName, CKeyStore::CONVERT_DOUBLE,
+                                    [this](std::string_view s) { return string2Double(s); });
+    }
 
-                szSection = szLine.substr(indexStart + sectionOpenChar_.size(), indexEnd -
-                                          (indexStart + sectionOpenChar_.size()));
+    /// @brief      Returns an uint16 tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag could was no
+    ///             found.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Converted values are cached.
+    /// @version    2026-10-18/GGB - Changed to std::string_view.
+    /// @version    2020-04-27/GGB - Function created.
 
-                logger::TRACEMESSAGE("Section Found: " + szSection);
+    virtual std::optional<std::uint16_t> tagValueUInt16(std::string_view section, std::string_view tagName)
+    {
+      return convertedValue<std::uint16_t>(section, tagName, CKeyStore::CONVERT_UINT16,
+                                           [this](std::string_view s) { return string2UInt16(s); });
+    }
 
-                sectionIterator = std::get<0>(sectionContainer.emplace(szSection, tagValueContainer_t()));
+    /// @brief      Returns an int32 tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag could was no
+    ///             found.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Converted values are cached.
+    /// @version    2026-10-18/GGB - Changed to std::string_view.
+    /// @version    2020-04-27/GGB - Function created.
 
-                if (szSection == section)
-                {
-                  sectionFound = true;
-                }
-                else if (sectionFound)
-                {
-                  linesReadAhead --;
-                }
-              };
-            }
-            else
-            {
-                // tag line
+    virtual std::optional<std::int32_t> tagValueInt32(std::string_view section, std::string_view tagName)
+    {
+      return convertedValue<std::int32_t>(section, tagName, CKeyStore::CONVERT_INT32,
+                                          [this](std::string_view s) { return string2Int32(s); });
+    }
 
-              std::size_t tokenEnd;
-              std::string tag, value;
+    /// @brief      Returns an int64 tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
 
-              tokenEnd = szLine.find(seperatorChar_);
-              if (tokenEnd != std::string::npos)
-              {
-                tag = szLine.substr(0, tokenEnd);
-                boost::trim(tag);
+    virtual std::optional<std::int64_t> tagValueInt64(std::string_view section, std::string_view tagName)
+    {
+      return convertedValue<std::int64_t>(section, tagName, CKeyStore::CONVERT_INT64,
+                                          [this](std::string_view s) { return string2Int64(s); });
+    }
 
-                value = szLine.substr(tokenEnd + seperatorChar_.size(), std::string::npos);
-                boost::trim(value);
+    /// @brief      Returns a uint64 tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted, or was too large for the type.
+    /// @version    2026-10-18/GGB - Function created.
 
-                logger::TRACEMESSAGE("Tag identified: " + tag  + " value: " + value);
+    virtual std::optional<std::uint64_t> tagValueUInt64(std::string_view section, std::string_view tagName)
+    {
+      return convertedValue<std::uint64_t>(section, tagName, CKeyStore::CONVERT_UINT64,
+                                           [this](std::string_view s) { return string2UInt64(s); });
+    }
 
-                if (sectionFound)
-                {
-                  if (tagFound)
-                  {
-                    if (linesReadAhead > 0)
-                    {
-                      linesReadAhead--;
-                    };
-                  }
-                  else if (tag == tagName)
-                  {
-                    logger::TRACEMESSAGE("Tag Found");
-
-                    tagFound = true;
-                    returnValue = value;
-                  };
-                };
-
-                sectionIterator->second.emplace(std::move(tag), std::move(value));
-              };
-            };
-          };
-        };  // while loop
-
-        if (ifs.eof())
-        {
-          readComplete_ = true;
-        };
-
-        ifs.close();
-      };  // end if
+    /// @brief      Returns a bool tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Function created.
 
-      return returnValue;
+    virtual std::optional<bool> tagValueBool(std::string_view section, std::string_view tagName)
+    {
+      return convertedValue<bool>(section, tagName, CKeyStore::CONVERT_BOOL,
+                                  [this](std::string_view s) { return string2Bool(s); });
     }
 
-  public:
-    using CReaderCore::tagValueDouble;
-    using CReaderCore::tagValueInt32;
-    using CReaderCore::tagValueString;
-    using CReaderCore::tagValueUInt16;
-
-    /// @brief      Constructor for the class. A single constructor is provided and the default constructor is deleted.
-    /// @param[in]  filename: The filename and path of the configuration file.
-    /// @param[in]  seperatorChar: The character(s) used for seperating statements.
-    /// @param[in]  commentChar: The character(s) used for indicating comments.
-    /// @throws     std::bad_alloc
-    /// @version    2020-11-30/GGB - Changed to suse std::filesystem.
-    /// @version    2020-04-27/GGB - Function created.
+    /// @brief      Returns a duration tag value.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Function created.
 
-    CReaderSections(std::filesystem::path const &filename, std::string seperatorChar = "=", std::string commentChar = "#")
-      :  CReaderCore(filename, seperatorChar, commentChar), sectionOpenChar_("["), sectionCloseChar_("]"), namespaceChar_("/")
+    virtual std::optional<std::chrono::nanoseconds> tagValueDuration(std::string_view section, std::string_view tagName)
     {
-    }
+      std::optional<std::chrono::nanoseconds> returnValue;
 
-    virtual ~CReaderSections() {}
+        // The count is cached, as the cache only stores plain values.
 
-    /// @brief Returns a tag value.
-    /// @param[in] section: The section to search for the tag.
-    /// @param[in] tagName: The name of the tag to find.
-    /// @returns A std::optional containing the data (if found)
-    /// @throws
-    /// @version 2020-04-27/GGB - Function created.
+      std::optional<std::int64_t> count = convertedValue<std::int64_t>(section, tagName, CKeyStore::CONVERT_DURATION,
+                                                                        [this](std::string_view s)
+                                                                        {
+                                                                          return string2Duration(s).count();
+                                                                        });
 
-    virtual std::optional<std::string> tagValueString(std::string const &section, std::string const &tagName)
-    {
-      return std::move(readTag(section + namespaceChar_ + tagName));
+      if (count)
+      {
+        returnValue = std::chrono::nanoseconds(*count);
+      };
+
+      return returnValue;
     }
 
-    /// @brief Returns a double tag value.
-    /// @param[in] section: The section to search for the tag.
-    /// @param[in] tagName: The name of the tag to find.
-    /// @returns A std::optional containing the data (if found and converted) A false optional implies the tag could was no found.
-    /// @throws std::runtime_error - The value was not able to be converted.
-    /// @version 2020-04-27/GGB - Function created.
+    /// @brief      Returns a size in bytes.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @returns    A std::optional containing the data (if found and converted) A false optional implies the tag was not found.
+    /// @throws     std::runtime_error - The value was not able to be converted.
+    /// @version    2026-10-18/GGB - Function created.
 
-    virtual std::optional<double> tagValueDouble(std::string const &section, std::string const &tagName)
+    virtual std::optional<std::uint64_t> tagValueByteSize(std::string_view section, std::string_view tagName)
     {
-      return std::move(tagValueDouble(section + namespaceChar_ + tagName));
+      return convertedValue<std::uint64_t>(section, tagName, CKeyStore::CONVERT_BYTESIZE,
+                                           [this](std::string_view s) { return string2ByteSize(s); });
     }
 
-    /// @brief Returns an uint16 tag value.
-    /// @param[in] section: The section to search for the tag.
-    /// @param[in] tagName: The name of the tag to find.
-    /// @returns A std::optional containing the data (if found and converted) A false optional implies the tag could was no found.
-    /// @throws std::runtime_error - The value was not able to be converted.
-    /// @throws std::out_of_range - The value was too large for the type.
-    /// @version 2020-04-27/GGB - Function created.
+    /// @brief      Returns a list tag value. Lists are not cached.
+    /// @param[in]  section: The section to search for the tag.
+    /// @param[in]  tagName: The name of the tag to find.
+    /// @param[in]  seperator: The character seperating the items.
+    /// @returns    A std::optional containing the items (if found)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-18/GGB - Function created.
 
-    virtual std::optional<std::uint16_t> tagValueUInt16(std::string const &section, std::string const &tagName)
+    virtual std::optional<std::vector<std::string>> tagValueList(std::string_view section, std::string_view tagName,
+                                                                 char seperator = ',')
     {
-      return std::move(tagValueUInt16(section + namespaceChar_ + tagName));
-    }
+      std::optional<std::vector<std::string>> returnValue;
+      CSnapshotGuard values = snapshot();
+      std::optional<std::string_view> value = values->find(section, tagName);
 
-    /// @brief Returns an int32 tag value.
-    /// @param[in] section: The section to search for the tag.
-    /// @param[in] tagName: The name of the tag to find.
-    /// @returns A std::optional containing the data (if found and converted) A false optional implies the tag could was no found.
-    /// @throws std::runtime_error - The value was not able to be converted.
-    /// @throws std::out_of_range - The value was too large for the type.
-    /// @version 2020-04-27/GGB - Function created.
+      if (value)
+      {
+        returnValue = string2List(*value, seperator);
+      };
 
-    virtual std::optional<std::int32_t> tagValueInt32(std::string const &section, std::string const &tagName)
-    {
-      return std::move(tagValueInt32(section + namespaceChar_ + tagName));
+      return returnValue;
     }
 
-
   }; // class
 
 } // namespace GCL
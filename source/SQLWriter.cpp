@@ -31,7 +31,20 @@
 //
 // CLASSES INCLUDED:    CSQLWriter
 //
-// HISTORY:             2020-04-25 GGB - Added offset functionality.
+// HISTORY:             2026-10-18 GGB - Added index and optimiser hints.
+//                      2026-10-18 GGB - Added common table expressions and window functions.
+//                      2026-10-18 GGB - Added aggregates, GROUP BY (with ROLLUP) and HAVING.
+//                      2026-10-18 GGB - Added interned identifiers and identifier quoting.
+//                      2026-10-18 GGB - Added parallel rendering of queries.
+//                      2026-10-18 GGB - Added validation of table and column names.
+//                      2026-10-18 GGB - Added bulk load queries and bulkLoadWriter.
+//                      2026-10-18 GGB - Added batched update queries.
+//                      2026-10-18 GGB - Shared database map and copy-on-write query storage.
+//                      2026-10-18 GGB - Added predicate expressions for where clauses.
+//                      2026-10-18 GGB - LIMIT/OFFSET and UPSERT for all dialects. Added keyset pagination.
+//                      2026-10-18 GGB - Added the rendered query cache.
+//                      2026-10-18 GGB - Hash indexed database map and memory mapped map file reader.
+//                      2020-04-25 GGB - Added offset functionality.
 //                      2019-12-08 GGB - Added UPSERT functionality for MYSQL.
 //                      2015-09-22 GGB - AIRDAS 2015.09 release
 //                      2013-01-26 GGB - Development of class for application AIRDAS
@@ -42,16 +55,31 @@
 
   // Standard C++ library files
 
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
 #include <fstream>
+#include <shared_mutex>
 #include <sstream>
+#include <thread>
 #include <typeinfo>
 #include <utility>
 
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
   // Miscellaneous library header files
 
 #include "boost/algorithm/string.hpp"
 #include "boost/format.hpp"
+#include "boost/interprocess/file_mapping.hpp"
+#include "boost/interprocess/mapped_region.hpp"
 #include "boost/locale.hpp"
 #include <SCL>
 
@@ -64,401 +92,2385 @@
 namespace GCL
 {
 
-  std::string const TABLE("TABLE");
-  std::string const COLUMN("COLUMN");
-  std::string const END("END");
+  std::string_view const TABLE("TABLE");
+  std::string_view const COLUMN("COLUMN");
+  std::string_view const END("END");
+
+  namespace
+  {
+    /// @brief      Removes leading and trailing whitespace from a string_view.
+    /// @param[in]  sv: The string_view to trim.
+    /// @returns    The trimmed view.
+    /// @throws     None.
+    /// @version    2026-10-18/GGB - Function created.
+
+    std::string_view trimView(std::string_view sv) noexcept
+    {
+      std::size_t first = sv.find_first_not_of(" \t\r");
+
+      if (first == std::string_view::npos)
+      {
+        return std::string_view();
+      }
+      else
+      {
+        return sv.substr(first, sv.find_last_not_of(" \t\r") - first + 1);
+      };
+    }
+
+    /// @brief    Accumulates the two independent hashes that make up a query fingerprint. hash1 is FNV-1a, hash2 is a
+    ///           multiply-rotate hash with a different seed.
+
+    class fingerprintHasher
+    {
+    private:
+      std::uint64_t hash1 = 0xCBF29CE484222325;
+      std::uint64_t hash2 = 0x9E3779B97F4A7C15;
+
+      void addByte(unsigned char c) noexcept
+      {
+        hash1 = (hash1 ^ c) * 0x00000100000001B3;
+        hash2 = (hash2 + c) * 0xC2B2AE3D27D4EB4F;
+        hash2 = (hash2 << 31) | (hash2 >> 33);
+      }
+
+    public:
+      void add(std::uint64_t value) noexcept
+      {
+        for (int index = 0; index < 8; index++)
+        {
+          addByte(static_cast<unsigned char>(value >> (index * 8)));
+        };
+      }
+
+      void add(std::string_view sv) noexcept
+      {
+        add(static_cast<std::uint64_t>(sv.size()));   // Length prefix keeps adjacent fields from running together.
+        for (char c : sv)
+        {
+          addByte(static_cast<unsigned char>(c));
+        };
+      }
+
+        // Adds the object representation of the value if the parameter holds a T.
+
+      template<typename T>
+      bool addValue(sqlWriter::parameter const &value) noexcept
+      {
+        T const *pointer = SCL::any_cast<T>(&value);
+
+        if (pointer)
+        {
+          unsigned char const *bytes = reinterpret_cast<unsigned char const *>(pointer);
+
+          for (std::size_t index = 0; index < sizeof(T); index++)
+          {
+            addByte(bytes[index]);
+          };
+        };
+
+        return (pointer != nullptr);
+      }
+
+      template<typename... T>
+      bool addValues(sqlWriter::parameter const &value) noexcept
+      {
+        return (addValue<T>(value) || ...);
+      }
+
+        // The type and the raw value are hashed, so that values are not converted to strings. Equal values of the same type
+        // always render the same text. long double is excluded as it contains padding bytes. Other types are converted.
+
+      void addParameter(sqlWriter::parameter const &value)
+      {
+        add(static_cast<std::uint64_t>(value.type().hash_code()));
+
+        if (value.type() == typeid(std::string))
+        {
+          add(*SCL::any_cast<std::string>(&value));
+        }
+        else if (value.type() == typeid(sqlWriter::bindValue))
+        {
+          add(SCL::any_cast<sqlWriter::bindValue>(&value)->str());
+        }
+        else if (value.type() == typeid(sqlWriter::nullValue))
+        {
+            // The type is the value.
+        }
+        else if (!addValues<bool, char, signed char, unsigned char, short, unsigned short, int, unsigned int, long, unsigned long,
+                            long long, unsigned long long, float, double>(value))
+        {
+          add(value.to_string());
+        };
+      }
+
+      template<typename T>
+      void add(std::optional<T> const &value)
+      {
+        add(static_cast<std::uint64_t>(value.has_value()));
+        if (value)
+        {
+          add(*value);
+        };
+      }
+
+      sqlWriter::fingerprint_t value() const noexcept { return {hash1, hash2}; }
+    };
+  }
 
   //******************************************************************************************************************************
   //
-  // CSQLWriter
+  // queryCache
   //
   //******************************************************************************************************************************
 
-  /// @brief      Function to capture the count expression
-  /// @param[in]  countExpression: The count expression to capture.
+  /// @brief      Removes all entries from the cache. The hit and miss counters are not reset.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::queryCache::clear()
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    entryMap.clear();
+    entryList.clear();
+  }
+
+  /// @brief      Searches the cache for a rendered query.
+  /// @param[in]  fp: The fingerprint of the query.
+  /// @returns    The rendered query if found.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<std::string> sqlWriter::queryCache::find(fingerprint_t const &fp)
+  {
+    std::optional<std::string> returnValue;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto iterator = entryMap.find(fp);
+
+    if (iterator != entryMap.end())
+    {
+      entryList.splice(entryList.begin(), entryList, iterator->second);   // Move to most recently used.
+      returnValue = iterator->second->second;
+      hits_++;
+    }
+    else
+    {
+      misses_++;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Inserts a rendered query into the cache, evicting the least recently used entry if the cache is full.
+  /// @param[in]  fp: The fingerprint of the query.
+  /// @param[in]  queryString: The rendered query.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::queryCache::insert(fingerprint_t const &fp, std::string const &queryString)
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    if ((capacity_ != 0) && (entryMap.find(fp) == entryMap.end()))
+    {
+      if (entryList.size() >= capacity_)
+      {
+        entryMap.erase(entryList.back().first);
+        entryList.pop_back();
+      };
+
+      entryList.emplace_front(fp, queryString);
+      entryMap.emplace(fp, entryList.begin());
+    };
+  }
+
+  /// @brief      Returns the number of entries in the cache.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::size_t sqlWriter::queryCache::size() const
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    return entryList.size();
+  }
+
+  //******************************************************************************************************************************
+  //
+  // bulkLoadWriter
+  //
+  //******************************************************************************************************************************
+
+  /// @brief      Constructs a writer that writes to a stream.
+  /// @param[in]  os: The stream to write to.
+  /// @param[in]  d: The dialect of the database.
+  /// @param[in]  f: The format of the data.
+  /// @param[in]  columns: The number of columns in each row.
+  /// @param[in]  bs: The size of the buffer.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::bulkLoadWriter::bulkLoadWriter(std::ostream &os, EDialect d, EBulkFormat f, std::size_t columns, std::size_t bs)
+    : outputStream(&os), dialect(d), format(f), columnCount(columns), bufferSize(bs)
+  {
+    checkDialect();
+    buffer.reserve(bufferSize + 256);
+  }
+
+  /// @brief      Constructs a writer that writes to a file descriptor. (File, pipe or socket)
+  /// @param[in]  fd: The file descriptor to write to. The descriptor is not closed by the writer.
+  /// @param[in]  d: The dialect of the database.
+  /// @param[in]  f: The format of the data.
+  /// @param[in]  columns: The number of columns in each row.
+  /// @param[in]  bs: The size of the buffer.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::bulkLoadWriter::bulkLoadWriter(int fd, EDialect d, EBulkFormat f, std::size_t columns, std::size_t bs)
+    : fileDescriptor(fd), dialect(d), format(f), columnCount(columns), bufferSize(bs)
+  {
+    checkDialect();
+    buffer.reserve(bufferSize + 256);
+  }
+
+  /// @brief      Destructor. Flushes any buffered data.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::bulkLoadWriter::~bulkLoadWriter()
+  {
+    try
+    {
+      flush();
+    }
+    catch(...)
+    {
+    };
+  }
+
+  /// @brief      Checks that bulk loading is supported for the dialect.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::bulkLoadWriter::checkDialect() const
+  {
+    if ((dialect != MYSQL) && (dialect != POSTGRE))
+    {
+      RUNTIME_ERROR(boost::locale::translate("Bulk load is only supported for MYSQL and POSTGRE."), E_SQLWRITER_NOTSUPPORTED,
+                    LIBRARYNAME);
+    };
+  }
+
+  /// @brief      Writes the buffered data to the output.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::bulkLoadWriter::flush()
+  {
+    if (outputStream)
+    {
+      outputStream->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      outputStream->flush();
+
+      if (!(*outputStream))
+      {
+        RUNTIME_ERROR(boost::locale::translate("Error writing bulk load data."), E_SQLWRITER_WRITEERROR, LIBRARYNAME);
+      };
+    }
+    else
+    {
+      std::size_t written = 0;
+
+      while (written < buffer.size())
+      {
+#if defined(_WIN32)
+        int result = _write(fileDescriptor, buffer.data() + written, static_cast<unsigned int>(buffer.size() - written));
+#else
+        ssize_t result = ::write(fileDescriptor, buffer.data() + written, buffer.size() - written);
+#endif
+        if (result >= 0)
+        {
+          written += static_cast<std::size_t>(result);
+        }
+        else if (errno != EINTR)
+        {
+          RUNTIME_ERROR(boost::locale::translate("Error writing bulk load data."), E_SQLWRITER_WRITEERROR, LIBRARYNAME);
+        };
+      };
+    };
+
+    buffer.clear();
+  }
+
+  /// @brief      Writes a string escaped for the text format. Backslash, tab, newline and carriage return are escaped. MYSQL also
+  ///             escapes the nul character.
+  /// @param[in]  value: The value to write.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::bulkLoadWriter::writeEscaped(std::string_view value)
+  {
+    std::size_t start = 0;
+
+    for (std::size_t index = 0; index < value.size(); index++)
+    {
+      char escape = 0;
+
+      switch (value[index])
+      {
+        case '\\':
+        {
+          escape = '\\';
+          break;
+        };
+        case '\t':
+        {
+          escape = 't';
+          break;
+        };
+        case '\n':
+        {
+          escape = 'n';
+          break;
+        };
+        case '\r':
+        {
+          escape = 'r';
+          break;
+        };
+        case '\0':
+        {
+          escape = (dialect == MYSQL) ? '0' : 0;
+          break;
+        };
+        default:
+        {
+          break;
+        };
+      };
+
+      if (escape != 0)
+      {
+        buffer.append(value.data() + start, index - start);
+        buffer.push_back('\\');
+        buffer.push_back(escape);
+        start = index + 1;
+      };
+    };
+
+    buffer.append(value.data() + start, value.size() - start);
+  }
+
+  /// @brief      Writes a string quoted for the CSV format. Embedded quotes are doubled.
+  /// @param[in]  value: The value to write.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::bulkLoadWriter::writeQuoted(std::string_view value)
+  {
+    std::size_t start = 0;
+    std::size_t index;
+
+    buffer.push_back('"');
+    while ((index = value.find('"', start)) != std::string_view::npos)
+    {
+      buffer.append(value.data() + start, index + 1 - start);
+      buffer.push_back('"');
+      start = index + 1;
+    };
+    buffer.append(value.data() + start, value.size() - start);
+    buffer.push_back('"');
+  }
+
+  /// @brief      Writes a row of data. The buffer is flushed if it is full.
+  /// @param[in]  row: The values for each column.
   /// @returns    (*this)
-  /// @throws     None
-  /// @version    2017-08-12/GGB - Function created.
+  /// @throws     GCL::CRuntimeAssert
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
 
-  sqlWriter &sqlWriter::count(std::string const &countExpression)
+  sqlWriter::bulkLoadWriter &sqlWriter::bulkLoadWriter::writeRow(parameterStorage const &row)
   {
-    countValue = countExpression;
+    RUNTIME_ASSERT(row.size() == columnCount, boost::locale::translate("Bulk load rows must contain a value for each column."));
+
+    char delimiter = (format == BULK_CSV) ? ',' : '\t';
+    bool first = true;
+
+    for (auto const &element : row)
+    {
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        buffer.push_back(delimiter);
+      };
+      writeValue(element);
+    };
+    buffer.push_back('\n');
+    rowCount++;
+
+    if (buffer.size() >= bufferSize)
+    {
+      flush();
+    };
 
     return (*this);
   }
 
-  /// @brief      Creates the test for the specified delete query.
-  /// @returns    a string representation of the delete query.
-  /// @version    2018-05-12/GGB - Function created.
+  /// @brief      Writes a single value.
+  /// @param[in]  value: The value to write.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
 
-  std::string sqlWriter::createDeleteQuery() const
+  void sqlWriter::bulkLoadWriter::writeValue(parameter const &value)
+  {
+    if (value.type() == typeid(nullValue))
+    {
+      if (format == BULK_TEXT)
+      {
+        buffer += "\\N";
+      }
+      else if (dialect == MYSQL)
+      {
+        buffer += "NULL";       // Unquoted NULL is read as NULL when ESCAPED BY is empty.
+      };                        // POSTGRE reads an unquoted empty value as NULL.
+    }
+    else if (value.type() == typeid(bool))
+    {
+      std::string temp = value.to_string();
+      bool flag = (temp == "true") || (temp == "1");
+
+      if (dialect == MYSQL)
+      {
+        buffer.push_back(flag ? '1' : '0');
+      }
+      else
+      {
+        buffer.push_back(flag ? 't' : 'f');
+      };
+    }
+    else if (format == BULK_CSV)
+    {
+      if (value.type() == typeid(std::string))
+      {
+        writeQuoted(value.to_string());
+      }
+      else
+      {
+        buffer += value.to_string();
+      };
+    }
+    else
+    {
+      writeEscaped(value.to_string());
+    };
+  }
+
+  //******************************************************************************************************************************
+  //
+  // identifier
+  //
+  //******************************************************************************************************************************
+
+  /// @brief      Returns the entry of the empty name. The entry is created on first use and does not use the intern table.
+  /// @returns    Pointer to the entry.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::identifier::SIdentifierData const *sqlWriter::identifier::emptyData() noexcept
+  {
+    static SIdentifierData const returnValue;
+
+    return &returnValue;
+  }
+
+  /// @brief      Returns the entry for a name, adding it to the table if it has not been seen before.
+  /// @param[in]  name: The name to intern.
+  /// @returns    Pointer to the entry. Entries are never released.
+  /// @throws     std::bad_alloc
+  /// @note       The table is shared by all writers. It is split into shards by the hash of the name, each protected by a
+  ///             shared mutex. Names that are already interned are found under a shared lock, so concurrent writers only
+  ///             contend when adding new names to the same shard.
+  /// @version    2026-10-18/GGB - Sharded table with a shared lock for lookups. The empty name is not interned.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::identifier::SIdentifierData const *sqlWriter::identifier::intern(std::string_view name)
+  {
+    struct SShard
+    {
+      std::shared_mutex mutex;
+      std::deque<SIdentifierData> identifierData;                 // std::deque does not move elements when growing.
+      std::unordered_map<std::string_view, SIdentifierData const *> identifierIndex;
+    };
+
+    constexpr std::size_t shardCount = 16;
+    static std::array<SShard, shardCount> shards;
+
+    SIdentifierData const *returnValue = nullptr;
+
+    if (name.empty())
+    {
+      returnValue = emptyData();
+    }
+    else
+    {
+      SShard &shard = shards[std::hash<std::string_view>()(name) % shardCount];
+
+      {
+        std::shared_lock<std::shared_mutex> readLock(shard.mutex);
+        auto iterator = shard.identifierIndex.find(name);
+
+        if (iterator != shard.identifierIndex.end())
+        {
+          returnValue = iterator->second;
+        };
+      };
+
+      if (!returnValue)
+      {
+        std::unique_lock<std::shared_mutex> writeLock(shard.mutex);
+        auto iterator = shard.identifierIndex.find(name);     // Another thread may have added the name.
+
+        if (iterator != shard.identifierIndex.end())
+        {
+          returnValue = iterator->second;
+        }
+        else
+        {
+          SIdentifierData &entry = shard.identifierData.emplace_back();
+
+          entry.name = name;
+          for (auto d : {MYSQL, ORACLE, MICROSOFT, POSTGRE})
+          {
+            entry.quotedName[d] = quote(name, d);
+          };
+          shard.identifierIndex.emplace(entry.name, &entry);
+          returnValue = &entry;
+        };
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Quotes a name for a dialect. Each part of a qualified name is quoted separately and wildcards are not quoted.
+  /// @param[in]  name: The name to quote. (name, table.name or table.*)
+  /// @param[in]  dialect: The dialect to quote for.
+  /// @returns    The quoted name. Names that are not plain identifiers (expressions, already quoted) are returned unchanged.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::identifier::quote(std::string_view name, EDialect dialect)
+  {
+    std::string returnValue;
+    char openQuote, closeQuote;
+    bool plain = !name.empty();
+    std::size_t first = 0;
+
+    switch (dialect)
+    {
+      case MYSQL:
+      {
+        openQuote = closeQuote = '`';
+        break;
+      };
+      case MICROSOFT:
+      {
+        openQuote = '[';
+        closeQuote = ']';
+        break;
+      };
+      default:
+      {
+        openQuote = closeQuote = '"';
+        break;
+      };
+    };
+
+      // Check that each part is a plain identifier. Only the last part may be a wildcard.
+
+    while (plain && (first <= name.size()))
+    {
+      std::size_t last = std::min(name.find('.', first), name.size());
+      std::string_view part = name.substr(first, last - first);
+
+      if (part == "*")
+      {
+        plain = (last == name.size()) && (first != 0);
+      }
+      else
+      {
+        plain = !part.empty() &&
+                std::all_of(part.begin(), part.end(), [](char c)
+                {
+                  return std::isalnum(static_cast<unsigned char>(c)) || (c == '_') || (c == '$') || (c == '#') ||
+                         (static_cast<unsigned char>(c) >= 0x80);
+                });
+      };
+      first = last + 1;
+    };
+
+    if (plain)
+    {
+      first = 0;
+      while (first <= name.size())
+      {
+        std::size_t last = std::min(name.find('.', first), name.size());
+        std::string_view part = name.substr(first, last - first);
+
+        if (first != 0)
+        {
+          returnValue += '.';
+        };
+
+        if (part == "*")
+        {
+          returnValue += part;
+        }
+        else
+        {
+          returnValue += openQuote;
+          returnValue += part;
+          returnValue += closeQuote;
+        };
+        first = last + 1;
+      };
+    }
+    else
+    {
+      returnValue = name;
+    };
+
+    return returnValue;
+  }
+
+  //******************************************************************************************************************************
+  //
+  // CDatabaseMap
+  //
+  //******************************************************************************************************************************
+
+  /// @brief      Copy constructor. The indexes refer to the storage of the source and must be rebuilt.
+  /// @param[in]  other: The instance to copy.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::CDatabaseMap::CDatabaseMap(CDatabaseMap const &other) : tableData(other.tableData), columnData(other.columnData),
+    version_(other.version_)
+  {
+    rebuildIndex();
+  }
+
+  /// @brief      Copy assignment. The indexes refer to the storage of the source and must be rebuilt.
+  /// @param[in]  other: The instance to copy.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::CDatabaseMap &sqlWriter::CDatabaseMap::operator=(CDatabaseMap const &other)
+  {
+    if (this != &other)
+    {
+      tableData = other.tableData;
+      columnData = other.columnData;
+      version_ = other.version_;
+      rebuildIndex();
+    };
+
+    return (*this);
+  }
+
+  /// @brief      Gives the map a new version after a change. The counter is shared by all maps, so no two states of any maps
+  ///             have the same version.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::CDatabaseMap::changed() noexcept
+  {
+    static std::atomic<std::uint64_t> versionCounter{0};
+
+    version_ = versionCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  /// @brief      Adds a column to a table.
+  /// @param[in]  tableID: The table to add the column to.
+  /// @param[in]  columnName: The name of the column.
+  /// @returns    The ID of the new column. If the column already exists in the table, the optional has no value.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Changes the map version.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<sqlWriter::CDatabaseMap::columnID_t> sqlWriter::CDatabaseMap::createColumn(tableID_t tableID,
+                                                                                           std::string_view columnName)
+  {
+    std::optional<columnID_t> returnValue;
+    STableData &table = tableData[tableID];
+
+    if (table.columnIndex.find(columnName) == table.columnIndex.end())
+    {
+      columnID_t columnID = static_cast<columnID_t>(columnData.size());
+      SColumnData &column = columnData.emplace_back(SColumnData{tableID, std::string(columnName), std::string(), false});
+
+      table.columnIndex.emplace(column.columnName, columnID);
+
+        // Unqualified column names are only resolvable if they are unique across all tables.
+
+      auto [iterator, inserted] = columnIndex.emplace(column.columnName, columnID);
+      if (!inserted)
+      {
+        iterator->second = AMBIGUOUS_COLUMN;
+      };
+
+      changed();
+      returnValue = columnID;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Adds a table to the map.
+  /// @param[in]  tableName: The name of the table.
+  /// @returns    The ID of the new table. If the table already exists, the optional has no value.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Changes the map version.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<sqlWriter::CDatabaseMap::tableID_t> sqlWriter::CDatabaseMap::createTable(std::string_view tableName)
+  {
+    std::optional<tableID_t> returnValue;
+
+    if (tableIndex.find(tableName) == tableIndex.end())
+    {
+      tableID_t tableID = static_cast<tableID_t>(tableData.size());
+      STableData &table = tableData.emplace_back();
+
+      table.tableName = tableName;
+      tableIndex.emplace(table.tableName, tableID);
+
+      changed();
+      returnValue = tableID;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Finds a column within a table.
+  /// @param[in]  tableID: The table to search.
+  /// @param[in]  columnName: The column name to find.
+  /// @returns    The column ID (if found).
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<sqlWriter::CDatabaseMap::columnID_t> sqlWriter::CDatabaseMap::findColumn(tableID_t tableID,
+                                                                                         std::string_view columnName) const
+  {
+    std::optional<columnID_t> returnValue;
+    STableData const &table = tableData[tableID];
+    auto iterator = table.columnIndex.find(columnName);
+
+    if (iterator != table.columnIndex.end())
+    {
+      returnValue = iterator->second;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Finds a column using either a qualified (table.column) or unqualified column name.
+  /// @param[in]  columnName: The column name to find.
+  /// @returns    The column ID (if found). Unqualified names that exist in more than one table are not found.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<sqlWriter::CDatabaseMap::columnID_t> sqlWriter::CDatabaseMap::findColumn(std::string_view columnName) const
+  {
+    std::optional<columnID_t> returnValue;
+    std::size_t dotPosn = columnName.find('.');
+
+    if (dotPosn != std::string_view::npos)
+    {
+      std::optional<tableID_t> tableID = findTable(columnName.substr(0, dotPosn));
+
+      if (tableID)
+      {
+        returnValue = findColumn(*tableID, columnName.substr(dotPosn + 1));
+      };
+    }
+    else
+    {
+      auto iterator = columnIndex.find(columnName);
+
+      if ((iterator != columnIndex.end()) && (iterator->second != AMBIGUOUS_COLUMN))
+      {
+        returnValue = iterator->second;
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Finds a table.
+  /// @param[in]  tableName: The table name to find.
+  /// @returns    The table ID (if found).
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<sqlWriter::CDatabaseMap::tableID_t> sqlWriter::CDatabaseMap::findTable(std::string_view tableName) const
+  {
+    std::optional<tableID_t> returnValue;
+    auto iterator = tableIndex.find(tableName);
+
+    if (iterator != tableIndex.end())
+    {
+      returnValue = iterator->second;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Returns the name of the column as it is known to the database.
+  /// @param[in]  columnID: The column to return.
+  /// @returns    The mapped name if the column is mapped, otherwise the column name.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string_view sqlWriter::CDatabaseMap::mappedColumnName(columnID_t columnID) const
+  {
+    SColumnData const &column = columnData[columnID];
+
+    return column.columnMap.empty() ? column.columnName : column.columnMap;
+  }
+
+  /// @brief      Returns the name of the table as it is known to the database.
+  /// @param[in]  tableID: The table to return.
+  /// @returns    The mapped name if the table is mapped, otherwise the table name.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string_view sqlWriter::CDatabaseMap::mappedTableName(tableID_t tableID) const
+  {
+    STableData const &table = tableData[tableID];
+
+    return table.tableMap.empty() ? table.tableName : table.tableMap;
+  }
+
+  /// @brief      Rebuilds all the indexes to refer to the names held in this instance.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::CDatabaseMap::rebuildIndex()
+  {
+    tableIndex.clear();
+    columnIndex.clear();
+
+    for (tableID_t tableID = 0; tableID < tableData.size(); tableID++)
+    {
+      tableData[tableID].columnIndex.clear();
+      tableIndex.emplace(tableData[tableID].tableName, tableID);
+    };
+
+    for (columnID_t columnID = 0; columnID < columnData.size(); columnID++)
+    {
+      SColumnData const &column = columnData[columnID];
+
+      tableData[column.tableID].columnIndex.emplace(column.columnName, columnID);
+
+      auto [iterator, inserted] = columnIndex.emplace(column.columnName, columnID);
+      if (!inserted)
+      {
+        iterator->second = AMBIGUOUS_COLUMN;
+      };
+    };
+  }
+
+  //******************************************************************************************************************************
+  //
+  // CSQLWriter
+  //
+  //******************************************************************************************************************************
+
+  /// @brief      Adds the resolved reference for a column name to a clause if validation is enabled.
+  /// @param[in]  refs: The references for the clause. (Parallel to the clause)
+  /// @param[in]  columnName: The column name being added to the clause.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::addColumnRef(columnRefStorage_t &refs, std::string const &columnName)
+  {
+    if (validateNames_)
+    {
+      refs.push_back(resolveColumn(columnName));
+    };
+  }
+
+  /// @brief      Adds an aggregate expression to the select clause. @c aggregate(AGG_SUM, "amount", "total")
+  /// @param[in]  function: The aggregate function.
+  /// @param[in]  column: The column to aggregate. ("*" may be used with AGG_COUNT)
+  /// @param[in]  as: The alias for the aggregate. (Optional)
+  /// @returns    (*this)
+  /// @throws     GCL::runtime_error (If validation is enabled)
+  /// @version    2026-10-18/GGB - The column is validated.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::aggregate(EAggregate function, std::string const &column, std::string const &as)
+  {
+    addColumnRef(aggregateColumnRefs, column);
+    aggregateFields.emplace_back(function, column, as);
+
+    return (*this);
+  }
+
+  /// @brief      Returns the string for an aggregate expression.
+  /// @param[in]  function: The aggregate function.
+  /// @param[in]  column: The column to aggregate.
+  /// @param[in]  refs: The resolved references of the clause.
+  /// @param[in]  index: The index of the column in the clause.
+  /// @param[in]  count: The number of entries in the clause.
+  /// @returns    The aggregate expression. (eg SUM(amount))
+  /// @throws     GCL::CCodeError
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Uses the resolved column if the name was validated.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::aggregateString(EAggregate function, std::string const &column, columnRefStorage_t const &refs,
+                                         std::size_t index, std::size_t count) const
+  {
+    std::string returnValue;
+
+    switch (function)
+    {
+      case AGG_COUNT:
+      {
+        returnValue = "COUNT(";
+        break;
+      };
+      case AGG_COUNT_DISTINCT:
+      {
+        returnValue = "COUNT(DISTINCT ";
+        break;
+      };
+      case AGG_SUM:
+      {
+        returnValue = "SUM(";
+        break;
+      };
+      case AGG_AVG:
+      {
+        returnValue = "AVG(";
+        break;
+      };
+      case AGG_MIN:
+      {
+        returnValue = "MIN(";
+        break;
+      };
+      case AGG_MAX:
+      {
+        returnValue = "MAX(";
+        break;
+      };
+      default:
+      {
+        CODE_ERROR;
+        break;
+      };
+    };
+
+    if (column == "*")
+    {
+      returnValue += column;
+    }
+    else
+    {
+      returnValue += mappedColumn(column, refs, index, count);
+    };
+    returnValue += ")";
+
+    return returnValue;
+  }
+
+  /// @brief      Adds an AVG() function to the query.
+  /// @param[in]  column: The name of the column to average.
+  /// @param[in]  as: The column name to assign to the AVG() function.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::avg(std::string const &column, std::string const &as)
+  {
+    return aggregate(AGG_AVG, column, as);
+  }
+
+  /// @brief      Starts a bulk load query. string() returns the control statement and the data is written with a writer returned
+  ///             by bulkWriter().
+  /// @param[in]  tableName: The table to load.
+  /// @param[in]  columns: The columns in each row of data.
+  /// @param[in]  format: The format of the data.
+  /// @param[in]  fileName: The file name for LOAD DATA LOCAL INFILE. (MYSQL only) This is the name the client library will
+  ///             read, which may be a named pipe or a name intercepted by a local infile handler.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::bulkLoad(std::string const &tableName, std::initializer_list<std::string> columns, EBulkFormat format,
+                                 std::string const &fileName)
+  {
+    if (queryType != qt_none)
+    {
+      resetQuery();
+    };
+
+    queryType = qt_bulkLoad;
+
+    if (validateNames_)
+    {
+      resolveTable(tableName);
+    };
+
+    insertTable = tableName;
+    bulkFormat = format;
+    bulkFileName = fileName;
+
+    for (auto const &element : columns)
+    {
+      addColumnRef(selectColumnRefs, element);
+      selectFields.push_back(element);
+    };
+
+    return (*this);
+  }
+
+  /// @brief      Returns a writer for the data payload of a bulk load query.
+  /// @param[in]  os: The stream to write the data to.
+  /// @returns    The writer.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::bulkLoadWriter sqlWriter::bulkWriter(std::ostream &os) const
+  {
+    RUNTIME_ASSERT(queryType == qt_bulkLoad, boost::locale::translate("bulkWriter() requires a bulk load query."));
+
+    return bulkLoadWriter(os, dialect, bulkFormat, selectFields.size());
+  }
+
+  /// @brief      Returns a writer for the data payload of a bulk load query.
+  /// @param[in]  fd: The file descriptor to write the data to.
+  /// @returns    The writer.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::bulkLoadWriter sqlWriter::bulkWriter(int fd) const
+  {
+    RUNTIME_ASSERT(queryType == qt_bulkLoad, boost::locale::translate("bulkWriter() requires a bulk load query."));
+
+    return bulkLoadWriter(fd, dialect, bulkFormat, selectFields.size());
+  }
+
+  /// @brief      Function to capture the count expression
+  /// @param[in]  countExpression: The count expression to capture.
+  /// @returns    (*this)
+  /// @throws     None
+  /// @version    2017-08-12/GGB - Function created.
+
+  sqlWriter &sqlWriter::count(std::string const &countExpression)
+  {
+    countValue = countExpression;
+
+    return (*this);
+  }
+
+  /// @brief      Creates the test for the specified delete query.
+  /// @returns    a string representation of the delete query.
+  /// @version    2026-10-18/GGB - The where clause is omitted if there are no conditions.
+  /// @version    2018-05-12/GGB - Function created.
+
+  std::string sqlWriter::createDeleteQuery() const
+  {
+    std::string returnValue = "DELETE FROM ";
+
+    returnValue += getTableMap(deleteTable);
+
+    returnValue += createWhereClause();
+
+    return returnValue;
+  }
+
+  /// @brief      Returns the database map for modification. If the map is shared with other writers, or was supplied by the
+  ///             user, a private copy is made first.
+  /// @returns    Reference to the database map.
+  /// @throws     std::bad_alloc
+  /// @note       Maps created by the writer are never const objects, so the const_cast is safe once the map is not shared.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::CDatabaseMap &sqlWriter::mutableDatabaseMap()
+  {
+    if (!ownsDatabaseMap_ || (databaseMap_.use_count() > 1))
+    {
+      std::shared_ptr<CDatabaseMap> newMap = std::make_shared<CDatabaseMap>(*databaseMap_);
+
+      databaseMap_ = newMap;
+      ownsDatabaseMap_ = true;
+      return *newMap;
+    }
+    else
+    {
+      return const_cast<CDatabaseMap &>(*databaseMap_);
+    };
+  }
+
+  /// @brief      Renders the query as a string.
+  /// @returns    The SQL query as a string.
+  /// @throws     GCL::CCodeError
+  /// @version    2026-10-18/GGB - Added bulk loads.
+  /// @version    2026-10-18/GGB - Added batched updates.
+  /// @version    2026-10-18/GGB - Function created from string().
+
+  std::string sqlWriter::createQuery() const
+  {
+    std::string returnValue;
+
+    switch (queryType)
+    {
+      case qt_select:
+      {
+        returnValue = createSelectQuery();
+        break;
+      };
+      case qt_insert:
+      {
+        returnValue = createInsertQuery();
+        break;
+      };
+      case qt_update:
+      {
+        returnValue = createUpdateQuery();
+        break;
+      }
+      case qt_delete:
+      {
+        returnValue = createDeleteQuery();
+        break;
+      }
+      case qt_upsert:
+      {
+        returnValue = createUpsertQuery();
+        break;
+      }
+      case qt_updateBatch:
+      {
+        std::vector<std::vector<std::string>> batchValues = createBatchValues();
+
+        returnValue = createUpdateBatchQuery(batchValues, 0, batchValues.size());
+        break;
+      }
+      case qt_bulkLoad:
+      {
+        returnValue = createBulkLoadQuery();
+        break;
+      }
+      default:
+      {
+        CODE_ERROR;
+        break;
+      };
+    }
+
+    return returnValue;
+  }
+
+  /// @brief Creates the string for an insert query.
+  /// @returns The Insert Query as a string.
+  /// @throws None.
+  /// @version 2015-03-31/GGB - Function created.
+
+  std::string sqlWriter::createInsertQuery() const
+  {
+    std::string returnValue = "INSERT INTO " + getTableMap(insertTable) + "(";
+    bool firstRow = true;
+    bool firstValue = true;
+
+    // Output the column names.
+
+    for (std::size_t index = 0; index < selectFields.size(); index++)
+    {
+      if (firstValue)
+      {
+        firstValue = false;
+      }
+      else
+      {
+        returnValue += ", ";
+      };
+
+      returnValue += mappedColumn(selectFields[index].str(), selectColumnRefs, index, selectFields.size());
+    };
+
+    returnValue += ") VALUES ";
+
+    firstValue = true;
+
+    for (auto &outerElement : valueFields)
+    {
+      if (firstRow)
+      {
+        firstRow = false;
+      }
+      else
+      {
+        returnValue += ", ";
+      }
+
+      firstValue = true;
+      returnValue += "(";
+
+      for (auto & innerElement : outerElement)
+      {
+        if (firstValue)
+        {
+          firstValue = false;
+        }
+        else
+        {
+          returnValue += ", ";
+        };
+
+        if (innerElement.type() == typeid(std::string))
+        {
+          returnValue += "'" + innerElement.to_string() + "'";
+        }
+        else if (innerElement.type() == typeid(bindValue))
+        {
+          std::string temp = innerElement.to_string();
+
+          if (temp.front() == ':')
+          {
+            returnValue += temp;
+          }
+          else if (temp.front() == '?')
+          {
+            returnValue += temp;
+          }
+          else
+          {
+            returnValue += ":" + temp;
+          }
+        }
+        else
+        {
+          returnValue += innerElement.to_string();
+        };
+      };
+
+      returnValue += ")";
+    };
+
+    return returnValue;
+  }
+
+  /// @brief Creates the limit clause
+  /// @throws GCL::runtime_error
+  /// @note   MICROSOFT uses TOP in the select clause when there is no offset. OFFSET ... FETCH is used when an offset is present.
+  /// @version 2026-10-18/GGB - Added POSTGRE, ORACLE and MICROSOFT.
+  /// @version 2020-04-25/GGB - Function created.
+
+  std::string sqlWriter::createLimitClause() const
+  {
+    std::string returnValue;
+
+    switch (dialect)
+    {
+      case MYSQL:
+      {
+        // Offset does not have to be present. However if offset is present, then limit must also be present.
+
+        if (offsetValue)
+        {
+          returnValue = "LIMIT " + std::to_string(*offsetValue) + ", "
+                        + std::to_string(limitValue ? *limitValue : std::numeric_limits<std::uint64_t>::max()) + " ";
+        }
+        else
+        {
+          if (limitValue)
+          {
+            returnValue = "LIMIT " + std::to_string(*limitValue) + " ";
+          };
+        };
+        break;
+      };
+      case POSTGRE:
+      {
+        if (limitValue)
+        {
+          returnValue = "LIMIT " + std::to_string(*limitValue) + " ";
+        };
+        if (offsetValue)
+        {
+          returnValue += "OFFSET " + std::to_string(*offsetValue) + " ";
+        };
+        break;
+      }
+      case MICROSOFT:
+      {
+        if (offsetValue)
+        {
+          returnValue = "OFFSET " + std::to_string(*offsetValue) + " ROWS ";
+          if (limitValue)
+          {
+            returnValue += "FETCH NEXT " + std::to_string(*limitValue) + " ROWS ONLY ";
+          };
+        };
+        break;
+      }
+      case ORACLE:
+      {
+        if (offsetValue)
+        {
+          returnValue = "OFFSET " + std::to_string(*offsetValue) + " ROWS ";
+        };
+        if (limitValue)
+        {
+          returnValue += "FETCH NEXT " + std::to_string(*limitValue) + " ROWS ONLY ";
+        };
+        break;
+      }
+      default:
+      {
+        RUNTIME_ERROR(boost::locale::translate("Unknown dialect"), E_SQLWRITER_UNKNOWNDIALECT, LIBRARYNAME);
+      }
+    }
+
+    return returnValue;
+  }
+
+  /// @brief      Creates the keyset (seek) predicate for keyset pagination.
+  /// @returns    The predicate enclosed in brackets. If no last key values are stored an empty string is returned.
+  /// @throws     GCL::runtime_error
+  /// @note       MYSQL and POSTGRE support row value comparisons. ORACLE and MICROSOFT do not, so the comparison is expanded to
+  ///             (k1 > v1) OR (k1 = v1 AND k2 > v2) ...
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::createKeysetClause() const
+  {
+    std::string returnValue;
+    std::string comparison = (keysetOrder == ASC) ? " > " : " < ";
+
+    if (!keysetValues.empty())
+    {
+      if (keysetFields.size() == 1)
+      {
+        returnValue = "(" + getColumnMap(keysetFields.front()) + comparison + valueString(keysetValues.front()) + ")";
+      }
+      else
+      {
+        switch (dialect)
+        {
+          case MYSQL:
+          case POSTGRE:
+          {
+            std::string columns, values;
+
+            for (std::size_t index = 0; index < keysetFields.size(); index++)
+            {
+              if (index != 0)
+              {
+                columns += ", ";
+                values += ", ";
+              };
+              columns += getColumnMap(keysetFields[index]);
+              values += valueString(keysetValues[index]);
+            };
+
+            returnValue = "((" + columns + ")" + comparison + "(" + values + "))";
+            break;
+          }
+          case ORACLE:
+          case MICROSOFT:
+          {
+            returnValue = "(";
+
+            for (std::size_t outer = 0; outer < keysetFields.size(); outer++)
+            {
+              if (outer != 0)
+              {
+                returnValue += " OR ";
+              };
+              returnValue += "(";
+              for (std::size_t inner = 0; inner < outer; inner++)
+              {
+                returnValue += getColumnMap(keysetFields[inner]) + " = " + valueString(keysetValues[inner]) + " AND ";
+              };
+              returnValue += getColumnMap(keysetFields[outer]) + comparison + valueString(keysetValues[outer]) + ")";
+            };
+
+            returnValue += ")";
+            break;
+          }
+          default:
+          {
+            RUNTIME_ERROR(boost::locale::translate("Unknown dialect"), E_SQLWRITER_UNKNOWNDIALECT, LIBRARYNAME);
+          }
+        };
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Creates the set clause.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2017-08-21/GGB - Function created.
+
+  std::string sqlWriter::createSetClause() const
+  {
+    RUNTIME_ASSERT(!setFields.empty(), boost::locale::translate("No Set fields defined for update query."));
+
+    std::string returnValue = "SET ";
+    bool firstValue = true;
+
+    for (std::size_t index = 0; index < setFields.size(); index++)
+    {
+      parameterPair const &element = setFields[index];
+
+      if (firstValue)
+      {
+        firstValue = false;
+      }
+      else
+      {
+        returnValue += ", ";
+      };
+      returnValue += mappedColumn(element.first, setColumnRefs, index, setFields.size()) + " = ";
+
+      if (element.second.type() == typeid(std::string))
+      {
+        returnValue += "'" + element.second.to_string() + "'";
+      }
+      else if (element.second.type() == typeid(bindValue))
+      {
+        std::string temp = element.second.to_string();
+
+        if (temp.front() == ':')
+        {
+          returnValue += temp;
+        }
+        else if (temp.front() == '?')
+        {
+          returnValue += temp;
+        }
+        else
+        {
+          returnValue += ":" + temp;
+        }
+      }
+      else
+      {
+        returnValue += element.second.to_string();
+      };
+    };
+
+    return returnValue;
+
+  }
+
+  /// @brief Converts the query to a string. Specifically for an update query.
+  /// @throws
+  /// @version 2026-10-18/GGB - The where clause is omitted if there are no conditions.
+  /// @version 2017-08-21/GGB - Function created.
+
+  std::string sqlWriter::createUpdateQuery() const
+  {
+    std::string returnValue = "UPDATE " + getTableMap(updateTable) + " ";
+
+    returnValue += createSetClause();
+
+    returnValue += createWhereClause();
+
+    return returnValue;
+  }
+
+  /// @brief      Converts the rows of a batched update to strings. This is done once so that the strings can be used for both
+  ///             measuring and rendering the statements.
+  /// @returns    The key value followed by the column values for each row.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::vector<std::vector<std::string>> sqlWriter::createBatchValues() const
+  {
+    RUNTIME_ASSERT(!valueFields.empty(), boost::locale::translate("No rows defined for batched update query."));
+
+    std::vector<std::vector<std::string>> returnValue;
+
+    returnValue.reserve(valueFields.size());
+
+    for (auto const &row : valueFields)
+    {
+      RUNTIME_ASSERT(row.size() == selectFields.size() + 1,
+                     boost::locale::translate("Batched update rows must contain the key and a value for each column."));
+
+      std::vector<std::string> rowValues;
+
+      rowValues.reserve(row.size());
+      for (auto const &element : row)
+      {
+        rowValues.emplace_back(valueString(element));
+      };
+      returnValue.emplace_back(std::move(rowValues));
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Creates the control statement for a bulk load.
+  /// @returns    The COPY (POSTGRE) or LOAD DATA (MYSQL) statement.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::createBulkLoadQuery() const
+  {
+    RUNTIME_ASSERT(!selectFields.empty(), boost::locale::translate("No columns defined for bulk load query."));
+
+    std::string returnValue;
+    std::string columnList = "(";
+    bool first = true;
+
+    for (std::size_t index = 0; index < selectFields.size(); index++)
+    {
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        columnList += ", ";
+      };
+      columnList += mappedColumn(selectFields[index].str(), selectColumnRefs, index, selectFields.size());
+    };
+    columnList += ")";
+
+    switch (dialect)
+    {
+      case POSTGRE:
+      {
+        returnValue = "COPY " + getTableMap(insertTable) + " " + columnList + " FROM STDIN";
+        if (bulkFormat == BULK_CSV)
+        {
+          returnValue += " WITH (FORMAT csv)";
+        };
+        break;
+      };
+      case MYSQL:
+      {
+        RUNTIME_ASSERT(!bulkFileName.empty(), boost::locale::translate("LOAD DATA requires a file name."));
+
+        std::string fileName = bulkFileName;
+
+        boost::replace_all(fileName, "\\", "\\\\");
+        boost::replace_all(fileName, "'", "''");
+
+        returnValue = "LOAD DATA LOCAL INFILE '" + fileName + "' INTO TABLE " + getTableMap(insertTable);
+        if (bulkFormat == BULK_CSV)
+        {
+          returnValue += " FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '\"' ESCAPED BY ''";
+        }
+        else
+        {
+          returnValue += " FIELDS TERMINATED BY '\\t' ESCAPED BY '\\\\'";
+        };
+        returnValue += " LINES TERMINATED BY '\\n' " + columnList;
+        break;
+      };
+      default:
+      {
+        RUNTIME_ERROR(boost::locale::translate("Bulk load is only supported for MYSQL and POSTGRE."), E_SQLWRITER_NOTSUPPORTED,
+                      LIBRARYNAME);
+        break;
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Renders a batched update statement for the rows [first, last).
+  /// @param[in]  batchValues: The rendered values for all the rows. (From createBatchValues())
+  /// @param[in]  first: The first row to include.
+  /// @param[in]  last: One past the last row to include.
+  /// @returns    The update statement.
+  /// @throws     std::bad_alloc
+  /// @note       POSTGRE types string literals in a VALUES list as text. Columns of other types may need bind values.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::createUpdateBatchQuery(std::vector<std::vector<std::string>> const &batchValues,
+                                                std::size_t first, std::size_t last) const
+  {
+    std::string tableName = getTableMap(updateTable);
+    std::string keyName = getColumnMap(batchKey);
+    std::vector<std::string> columnNames;
+    std::string returnValue = "UPDATE " + tableName + " SET ";
+
+    for (std::size_t index = 0; index < selectFields.size(); index++)
+    {
+      columnNames.emplace_back(mappedColumn(selectFields[index].str(), selectColumnRefs, index, selectFields.size()));
+    };
+
+    if (dialect == POSTGRE)
+    {
+      for (std::size_t column = 0; column < columnNames.size(); column++)
+      {
+        if (column != 0)
+        {
+          returnValue += ", ";
+        };
+        returnValue += columnNames[column] + " = v." + columnNames[column];
+      };
+
+      returnValue += " FROM (VALUES ";
+      for (std::size_t row = first; row < last; row++)
+      {
+        if (row != first)
+        {
+          returnValue += ", ";
+        };
+        returnValue += "(";
+        for (std::size_t index = 0; index < batchValues[row].size(); index++)
+        {
+          if (index != 0)
+          {
+            returnValue += ", ";
+          };
+          returnValue += batchValues[row][index];
+        };
+        returnValue += ")";
+      };
+
+      returnValue += ") AS v(" + keyName;
+      for (auto const &element : columnNames)
+      {
+        returnValue += ", " + element;
+      };
+      returnValue += ") WHERE " + tableName + "." + keyName + " = v." + keyName;
+    }
+    else
+    {
+      for (std::size_t column = 0; column < columnNames.size(); column++)
+      {
+        if (column != 0)
+        {
+          returnValue += ", ";
+        };
+        returnValue += columnNames[column] + " = CASE " + keyName;
+        for (std::size_t row = first; row < last; row++)
+        {
+          returnValue += " WHEN " + batchValues[row][0] + " THEN " + batchValues[row][column + 1];
+        };
+        returnValue += " ELSE " + columnNames[column] + " END";
+      };
+
+      returnValue += " WHERE " + keyName + " IN (";
+      for (std::size_t row = first; row < last; row++)
+      {
+        if (row != first)
+        {
+          returnValue += ", ";
+        };
+        returnValue += batchValues[row][0];
+      };
+      returnValue += ")";
+    };
+
+    return returnValue;
+  }
+
+  /// @brief Converts the upsert query to a string.
+  /// @throws GCL::CRuntimeError
+  /// @note   The where() clauses identify the row (key) and the set() clauses are the values to insert or update.
+  /// @version 2026-10-18/GGB - Added POSTGRE (ON CONFLICT). ORACLE and MICROSOFT use a MERGE statement.
+  /// @version 2019-12-08/GGB - Function created.
+
+  std::string sqlWriter::createUpsertQuery() const
+  {
+    // Notes:
+    //  1. The where() clauses should be populated. These need to be converted to insert clauses for the insert function.
+    //  2. The set clause needs to be included in the insert clauses.
+
+    std::string returnValue;
+    std::string fieldNames;
+    std::string fieldValues;
+    bool firstValue = true;
+
+    if ((dialect == ORACLE) || (dialect == MICROSOFT))
+    {
+      return createMergeQuery();
+    };
+
+      // Create the field and value clauses for the insert into.
+
+    for (auto const &element : whereFields)
+    {
+      if (firstValue)
+      {
+        firstValue = false;
+      }
+      else
+      {
+        fieldNames += ", ";
+        fieldValues += ", ";
+      };
+
+      fieldNames += getColumnMap(std::get<0>(element));
+      fieldValues += valueString(std::get<2>(element));
+    };
+
+      // Add the set clause.
+
+    for (auto const &element : setFields)
+    {
+      if (firstValue)
+      {
+        firstValue = false;
+      }
+      else
+      {
+        fieldNames += ", ";
+        fieldValues += ", ";
+      };
+
+      fieldNames += getColumnMap(element.first);
+      fieldValues += valueString(element.second);
+    };
+
+    returnValue = "INSERT INTO " + getTableMap(insertTable) + "(";
+    returnValue += fieldNames + ") VALUES (";
+    returnValue += fieldValues + ") ";
+
+    firstValue = true;
+    fieldValues.clear();
+
+    switch(dialect)
+    {
+      case MYSQL:
+      {
+        returnValue += "ON DUPLICATE KEY UPDATE ";
+
+        for (auto const &element : setFields)
+        {
+          if (firstValue)
+          {
+            firstValue = false;
+          }
+          else
+          {
+            fieldValues += ", ";
+          };
+          fieldValues += getColumnMap(element.first) + " = " + valueString(element.second);
+        };
+
+        returnValue += fieldValues;
+
+        break;
+      }
+      case POSTGRE:
+      {
+          // The conflict target is the key columns. (The where clauses)
+
+        for (auto const &element : whereFields)
+        {
+          if (firstValue)
+          {
+            firstValue = false;
+          }
+          else
+          {
+            fieldValues += ", ";
+          };
+          fieldValues += getColumnMap(std::get<0>(element));
+        };
+
+        returnValue += "ON CONFLICT (" + fieldValues + ") ";
+
+        if (setFields.empty())
+        {
+          returnValue += "DO NOTHING";
+        }
+        else
+        {
+          returnValue += "DO UPDATE SET ";
+          firstValue = true;
+
+          for (auto const &element : setFields)
+          {
+            std::string columnName = getColumnMap(element.first);
+
+            if (firstValue)
+            {
+              firstValue = false;
+            }
+            else
+            {
+              returnValue += ", ";
+            };
+            returnValue += columnName + " = EXCLUDED." + columnName;
+          };
+        };
+        break;
+      }
+      default:
+      {
+        CODE_ERROR;
+      }
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Counts the clauses that share their storage with another writer. A fork shares all its non-empty clauses with
+  ///             the original until one of them is modified.
+  /// @param[in]  other: The writer to compare with.
+  /// @returns    The number of clauses held in the same storage by both writers.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::size_t sqlWriter::sharedClauses(sqlWriter const &other) const noexcept
+  {
+    std::size_t returnValue = 0;
+
+    for (bool shared : { selectFields.sharesStorage(other.selectFields), fromFields.sharesStorage(other.fromFields),
+                         whereFields.sharesStorage(other.whereFields), valueFields.sharesStorage(other.valueFields),
+                         orderByFields.sharesStorage(other.orderByFields), joinFields.sharesStorage(other.joinFields),
+                         minFields.sharesStorage(other.minFields), maxFields.sharesStorage(other.maxFields),
+                         aggregateFields.sharesStorage(other.aggregateFields), groupByFields.sharesStorage(other.groupByFields),
+                         havingFields.sharesStorage(other.havingFields), commonTables.sharesStorage(other.commonTables),
+                         windowFields.sharesStorage(other.windowFields), indexHints.sharesStorage(other.indexHints),
+                         queryHints.sharesStorage(other.queryHints), setFields.sharesStorage(other.setFields),
+                         keysetFields.sharesStorage(other.keysetFields), keysetValues.sharesStorage(other.keysetValues),
+                         predicateArena.sharesStorage(other.predicateArena),
+                         predicateChildren.sharesStorage(other.predicateChildren),
+                         predicateValues.sharesStorage(other.predicateValues),
+                         wherePredicates.sharesStorage(other.wherePredicates) })
+    {
+      if (shared)
+      {
+        ++returnValue;
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Returns the text placed between a table and its alias. ORACLE does not accept AS before a table alias.
+  /// @returns    " " for ORACLE, " AS " for all other dialects.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  char const *sqlWriter::aliasKeyword() const noexcept
+  {
+    return (dialect == ORACLE) ? " " : " AS ";
+  }
+
+  /// @brief      Creates a MERGE statement to implement an upsert for ORACLE and MICROSOFT.
+  /// @returns    The MERGE statement.
+  /// @throws     GCL::CCodeError
+  /// @details    @code upsert("tbl").set("Value", 2).where({"ID", "=", 1}) @endcode translates to
+  ///             @code MERGE INTO tbl target USING (SELECT 1 AS ID, 2 AS Value FROM DUAL) source ON (target.ID = source.ID)
+  ///             WHEN MATCHED THEN UPDATE SET target.Value = source.Value WHEN NOT MATCHED THEN INSERT (ID, Value)
+  ///             VALUES (source.ID, source.Value) @endcode
+  ///             MICROSOFT uses table aliases with AS, omits FROM DUAL and requires the statement to be terminated.
+  /// @version    2026-10-18/GGB - Alias keyword shared with the FROM clause.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::createMergeQuery() const
+  {
+    std::string returnValue;
+    std::string sourceColumns, onClause, updateClause, insertColumns, insertValues;
+
+    auto addColumn = [&](std::string const &columnName, parameter const &value)
+    {
+      if (!sourceColumns.empty())
+      {
+        sourceColumns += ", ";
+        insertColumns += ", ";
+        insertValues += ", ";
+      };
+      sourceColumns += valueString(value) + " AS " + columnName;
+      insertColumns += columnName;
+      insertValues += "source." + columnName;
+    };
+
+    for (auto const &element : whereFields)
+    {
+      std::string columnName = getColumnMap(std::get<0>(element));
+
+      addColumn(columnName, std::get<2>(element));
+      onClause += (onClause.empty() ? "" : " AND ") + ("target." + columnName + " = source." + columnName);
+    };
+
+    for (auto const &element : setFields)
+    {
+      std::string columnName = getColumnMap(element.first);
+
+      addColumn(columnName, element.second);
+      updateClause += (updateClause.empty() ? "" : ", ") + ("target." + columnName + " = source." + columnName);
+    };
+
+    returnValue = "MERGE INTO " + getTableMap(insertTable) + aliasKeyword() + "target USING (SELECT " + sourceColumns;
+    if (dialect == ORACLE)
+    {
+      returnValue += " FROM DUAL";
+    };
+    returnValue += std::string(")") + aliasKeyword() + "source ON (" + onClause + ") ";
+
+    if (!updateClause.empty())
+    {
+      returnValue += "WHEN MATCHED THEN UPDATE SET " + updateClause + " ";
+    };
+    returnValue += "WHEN NOT MATCHED THEN INSERT (" + insertColumns + ") VALUES (" + insertValues + ")";
+
+    if (dialect == MICROSOFT)
+    {
+      returnValue += ";";
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Converts the where clause to a string for creating the SQL string.
+  /// @returns    The where clause. An empty string if there are no conditions.
+  /// @throws
+  /// @version    2026-10-18/GGB - Values are converted with valueString(), so bind values are prefixed.
+  /// @version    2026-10-18/GGB - Returns an empty string if there are no conditions.
+  /// @version    2026-10-18/GGB - Added the predicate expressions.
+  /// @version    2026-10-18/GGB - Added the keyset predicate.
+  /// @version    2015-05-24/GGB - Function created.
+
+  std::string sqlWriter::createWhereClause() const
+  {
+    if (whereFields.empty() && keysetValues.empty() && wherePredicates.empty())
+    {
+      return std::string();
+    };
+
+    std::string returnValue = " WHERE ";
+    bool first = true;
+    tripleStorage::const_iterator iterator;
+    std::string keysetClause = createKeysetClause();
+
+    if (!keysetClause.empty())
+    {
+      returnValue += keysetClause;
+      first = false;
+    };
+
+    for (iterator = whereFields.begin(); iterator != whereFields.end(); iterator++)
+    {
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        returnValue += " AND ";
+      };
+
+      returnValue += "(";
+      returnValue += mappedColumn(std::get<0>(*iterator), whereColumnRefs, iterator - whereFields.begin(), whereFields.size());
+      returnValue += " ";
+      returnValue += std::get<1>(*iterator);
+      returnValue += " ";
+      returnValue += valueString(std::get<2>(*iterator));
+      returnValue += ")";
+    };
+
+    for (auto const &element : wherePredicates)
+    {
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        returnValue += " AND ";
+      };
+
+      createPredicate(returnValue, element);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Creates the "GROUP BY" clause.
+  /// @returns    A string representation of the "GROUP BY" clause.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::createGroupByClause() const
   {
-    std::string returnValue = "DELETE FROM ";
+    std::string returnValue;
+    std::string columns;
 
-    returnValue += getColumnMap(deleteTable);
+    for (std::size_t index = 0; index < groupByFields.size(); index++)
+    {
+      if (index != 0)
+      {
+        columns += ", ";
+      };
+      columns += mappedColumn(groupByFields[index], groupByColumnRefs, index, groupByFields.size());
+    };
 
-    returnValue += createWhereClause();
+    if (!groupByRollup)
+    {
+      returnValue = " GROUP BY " + columns;
+    }
+    else if (dialect == MYSQL)
+    {
+      returnValue = " GROUP BY " + columns + " WITH ROLLUP";
+    }
+    else
+    {
+      returnValue = " GROUP BY ROLLUP (" + columns + ")";
+    };
 
     return returnValue;
   }
 
-  /// @brief Creates the string for an insert query.
-  /// @returns The Insert Query as a string.
-  /// @throws None.
-  /// @version 2015-03-31/GGB - Function created.
+  /// @brief      Creates the "HAVING" clause. The conditions are joined with AND.
+  /// @returns    A string representation of the "HAVING" clause.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Uses the resolved columns if the names were validated.
+  /// @version    2026-10-18/GGB - Function created.
 
-  std::string sqlWriter::createInsertQuery() const
+  std::string sqlWriter::createHavingClause() const
   {
-    std::string returnValue = "INSERT INTO " + insertTable + "(";
-    bool firstRow = true;
-    bool firstValue = true;
-
-    // Output the column names.
+    std::string returnValue = " HAVING ";
 
-    for (auto &element : selectFields)
+    for (std::size_t index = 0; index < havingFields.size(); index++)
     {
-      std::string columnName;
+      having_t const &element = havingFields[index];
 
-      if (firstValue)
+      if (index != 0)
       {
-        firstValue = false;
+        returnValue += " AND ";
+      };
+
+      returnValue += "(";
+      if (std::get<0>(element))
+      {
+        returnValue += aggregateString(*std::get<0>(element), std::get<1>(element), havingColumnRefs, index, havingFields.size());
       }
       else
       {
-        returnValue += ", ";
+        returnValue += mappedColumn(std::get<1>(element), havingColumnRefs, index, havingFields.size());
       };
-      columnName = element;
-
-      returnValue += columnName;
+      returnValue += " " + std::get<2>(element) + " " + valueString(std::get<3>(element)) + ")";
     };
 
-    returnValue += ") VALUES ";
+    return returnValue;
+  }
 
-    firstValue = true;
+  /// @brief      Creates the "WITH" clause for the common table expressions.
+  /// @returns    A string representation of the "WITH" clause, including the trailing space.
+  /// @throws     std::bad_alloc
+  /// @note       RECURSIVE is only output for MYSQL and POSTGRE. ORACLE and MICROSOFT do not use the keyword.
+  /// @version    2026-10-18/GGB - Function created.
 
-    for (auto &outerElement : valueFields)
+  std::string sqlWriter::createWithClause() const
+  {
+    std::string returnValue = "WITH ";
+    bool first = true;
+
+    if ( ((dialect == MYSQL) || (dialect == POSTGRE)) &&
+         std::any_of(commonTables.begin(), commonTables.end(), [](SCommonTable const &ct) { return ct.recursive; }) )
     {
-      if (firstRow)
+      returnValue += "RECURSIVE ";
+    };
+
+    for (auto const &element : commonTables)
+    {
+      if (first)
       {
-        firstRow = false;
+        first = false;
       }
       else
       {
         returnValue += ", ";
-      }
+      };
 
-      firstValue = true;
-      returnValue += "(";
+      returnValue += quoteName(element.name);
 
-      for (auto & innerElement : outerElement)
+      if (!element.columns.empty())
       {
-        if (firstValue)
-        {
-          firstValue = false;
-        }
-        else
-        {
-          returnValue += ", ";
-        };
-
-        if (innerElement.type() == typeid(std::string))
-        {
-          returnValue += "'" + innerElement.to_string() + "'";
-        }
-        else if (innerElement.type() == typeid(bindValue))
+        returnValue += " (";
+        for (std::size_t index = 0; index < element.columns.size(); index++)
         {
-          std::string temp = innerElement.to_string();
-
-          if (temp.front() == ':')
-          {
-            returnValue += temp;
-          }
-          else if (temp.front() == '?')
-          {
-            returnValue += temp;
-          }
-          else
+          if (index != 0)
           {
-            returnValue += ":" + temp;
-          }
-        }
-        else
-        {
-          returnValue += innerElement.to_string();
+            returnValue += ", ";
+          };
+          returnValue += quoteName(element.columns[index]);
         };
+        returnValue += ")";
       };
 
-      returnValue += ")";
+      returnValue += " AS (" + element.query + ")";
     };
+    returnValue += " ";
 
     return returnValue;
   }
 
-  /// @brief Creates the limit clause
-  /// @throws None.
-  /// @version 2020-04-25/GGB - Function created.
+  /// @brief      Returns the string for a window function. @c ROW_NUMBER() OVER (PARTITION BY a ORDER BY b DESC) AS rn
+  /// @param[in]  window: The window function.
+  /// @returns    The window function expression.
+  /// @throws     GCL::CCodeError
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
 
-  std::string sqlWriter::createLimitClause() const
+  std::string sqlWriter::windowString(SWindowFunction const &window) const
   {
     std::string returnValue;
 
-    switch (dialect)
+    switch (window.function)
     {
-      case MYSQL:
+      case WIN_ROW_NUMBER:
       {
-        // Offset does not have to be present. However if offset is present, then limit must also be present.
-
-        if (offsetValue)
-        {
-          returnValue = "LIMIT " + std::to_string(*offsetValue) + ", "
-                        + std::to_string(limitValue ? *limitValue : std::numeric_limits<std::uint64_t>::max()) + " ";
-        }
-        else
-        {
-          if (limitValue)
-          {
-            returnValue = "LIMIT " + std::to_string(*limitValue) + " ";
-          };
-        };
+        returnValue = "ROW_NUMBER()";
         break;
       };
-      case POSTGRE:
+      case WIN_RANK:
       {
+        returnValue = "RANK()";
         break;
-      }
+      };
+      case WIN_DENSE_RANK:
+      {
+        returnValue = "DENSE_RANK()";
+        break;
+      };
+      case WIN_LAG:
+      {
+        returnValue = "LAG(" + getColumnMap(window.column) + ")";
+        break;
+      };
+      case WIN_LEAD:
+      {
+        returnValue = "LEAD(" + getColumnMap(window.column) + ")";
+        break;
+      };
+      case WIN_FIRST_VALUE:
+      {
+        returnValue = "FIRST_VALUE(" + getColumnMap(window.column) + ")";
+        break;
+      };
+      case WIN_LAST_VALUE:
+      {
+        returnValue = "LAST_VALUE(" + getColumnMap(window.column) + ")";
+        break;
+      };
+      case WIN_AGGREGATE:
+      {
+        returnValue = aggregateString(window.aggregate, window.column, columnRefStorage_t(), 0, 1);   // Not resolved.
+        break;
+      };
       default:
       {
-        RUNTIME_ERROR(boost::locale::translate("Unknown dialect"), E_SQLWRITER_UNKNOWNDIALECT, LIBRARYNAME);
-      }
-    }
-
-    return returnValue;
-  }
-
-  /// @brief      Creates the set clause.
-  /// @throws     GCL::CRuntimeAssert
-  /// @version    2017-08-21/GGB - Function created.
+        CODE_ERROR;
+        break;
+      };
+    };
 
-  std::string sqlWriter::createSetClause() const
-  {
-    RUNTIME_ASSERT(!setFields.empty(), boost::locale::translate("No Set fields defined for update query."));
+    returnValue += " OVER (";
 
-    std::string returnValue = "SET ";
-    bool firstValue = true;
+    for (std::size_t index = 0; index < window.partitionBy.size(); index++)
+    {
+      returnValue += (index == 0) ? "PARTITION BY " : ", ";
+      returnValue += getColumnMap(window.partitionBy[index]);
+    };
 
-    for (auto element : setFields)
+    for (std::size_t index = 0; index < window.orderBy.size(); index++)
     {
-      if (firstValue)
-      {
-        firstValue = false;
-      }
-      else
+      if (index != 0)
       {
         returnValue += ", ";
-      };
-      returnValue += element.first + " = ";
-
-      if (element.second.type() == typeid(std::string))
-      {
-        returnValue += "'" + element.second.to_string() + "'";
       }
-      else if (element.second.type() == typeid(bindValue))
+      else if (!window.partitionBy.empty())
       {
-        std::string temp = element.second.to_string();
-
-        if (temp.front() == ':')
-        {
-          returnValue += temp;
-        }
-        else if (temp.front() == '?')
-        {
-          returnValue += temp;
-        }
-        else
-        {
-          returnValue += ":" + temp;
-        }
+        returnValue += " ORDER BY ";
       }
       else
       {
-        returnValue += element.second.to_string();
+        returnValue += "ORDER BY ";
       };
+      returnValue += getColumnMap(window.orderBy[index].first);
+      returnValue += (window.orderBy[index].second == DESC) ? " DESC" : " ASC";
     };
+    returnValue += ")";
 
-    return returnValue;
-
-  }
-
-  /// @brief Converts the query to a string. Specifically for an update query.
-  /// @throws
-  /// @version 2017-08-21/GGB - Function created.
-
-  std::string sqlWriter::createUpdateQuery() const
-  {
-    std::string returnValue = "UPDATE " + updateTable + " ";
-
-    returnValue += createSetClause();
-
-    returnValue += createWhereClause();
+    if (!window.alias.empty())
+    {
+      returnValue += " AS " + quoteName(window.alias);
+    };
 
     return returnValue;
   }
 
-  /// @brief Converts the upsert query to a string.
-  /// @throws GCL::CRuntimeError
-  /// @version 2019-12-08/GGB - Function created.
+  /// @brief      Creates the optimiser hint comment for the MYSQL, ORACLE and POSTGRE dialects.
+  /// @returns    The hint comment (/*+ ... */ ) including the trailing space, or an empty string if there are no hints.
+  /// @throws     std::bad_alloc
+  /// @note       Index hints for MYSQL and MICROSOFT are output in the FROM clause. (See createTableHints())
+  /// @version    2026-10-18/GGB - Function created.
 
-  std::string sqlWriter::createUpsertQuery() const
+  std::string sqlWriter::createHintComment() const
   {
-    // Notes:
-    //  1. The where() clauses should be populated. These need to be converted to insert clauses for the insert function.
-    //  2. The set clause needs to be included in the insert clauses.
-
-    RUNTIME_ASSERT(dialect == MYSQL, boost::locale::translate("Upsert only implemented for MYSQL."));
-
     std::string returnValue;
-    std::string fieldNames;
-    std::string fieldValues;
-    bool firstValue = true;
+    std::vector<std::string> hints;
 
-    switch(dialect)
+    if ((dialect == ORACLE) || (dialect == POSTGRE))
     {
-      case MYSQL:
+      for (auto const &element : indexHints)
       {
-        // Create the field and value clauses for the insert into.
+        std::string hint;
+        std::string tableName = getTableMap(element.tableName);
 
-        for (auto const &element : whereFields)
-        {
-          if (firstValue)
-          {
-            firstValue = false;
-          }
-          else
-          {
-            fieldNames += ", ";
-            fieldValues += ", ";
-          };
+          // The hint must refer to the alias if the table has one.
 
-          fieldNames += getColumnMap(std::get<0>(element));
-          if (std::get<2>(element).type() == typeid(std::string))
-          {
-            fieldValues += "'" + std::get<2>(element).to_string() + "'";
-          }
-          else
+        for (auto const &table : fromFields)
+        {
+          if ((table.first.str() == element.tableName) && !table.second.empty())
           {
-            fieldValues += std::get<2>(element).to_string();
+            tableName = identifierString(table.second);
+            break;
           };
         };
 
-        // Add the set clause.
-
-        for (auto const &element : setFields)
+        if (dialect == ORACLE)
         {
-          if (firstValue)
-          {
-            firstValue = false;
-          }
-          else
+          hint = (element.hint == HINT_IGNORE_INDEX) ? "NO_INDEX(" : "INDEX(";
+          hint += tableName;
+          for (auto const &index : element.indexes)
           {
-            fieldNames += ", ";
-            fieldValues += ", ";
+            hint += " " + quoteName(index);
           };
-
-          fieldNames += getColumnMap(element.first);
-          if (element.second.type() == typeid(std::string))
-          {
-            fieldValues += "'" + element.second.to_string() + "'";
-          }
-          else
+        }
+        else if (element.hint == HINT_IGNORE_INDEX)
+        {
+          hint = "NoIndexScan(" + tableName;
+        }
+        else
+        {
+          hint = "IndexScan(" + tableName;
+          for (auto const &index : element.indexes)
           {
-            fieldValues += element.second.to_string();
+            hint += " " + quoteName(index);
           };
         };
+        hint += ")";
+        hints.push_back(std::move(hint));
+      };
+    };
 
-        // Before we can create the insert query, we need to
+    if (dialect != MICROSOFT)
+    {
+      hints.insert(hints.end(), queryHints.begin(), queryHints.end());
+    };
 
-        returnValue = "INSERT INTO " + insertTable + "(";
-        returnValue += fieldNames + ") VALUES (";
-        returnValue += fieldValues + ") ";
-        returnValue += "ON DUPLICATE KEY UPDATE ";
+    if (!hints.empty())
+    {
+      returnValue = "/*+ " + boost::algorithm::join(hints, " ") + " */ ";
+    };
+
+    return returnValue;
+  }
 
-        firstValue = true;
-        fieldValues.clear();
+  /// @brief      Creates the index hints for a table in the FROM clause. (MYSQL and MICROSOFT)
+  /// @param[in]  table: The table and alias from the FROM clause.
+  /// @returns    The index hints, beginning with a space, or an empty string if there are no hints for the table.
+  /// @throws     GCL::runtime_error (MICROSOFT does not support HINT_IGNORE_INDEX)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - HINT_FORCE_INDEX is output as INDEX(...) for MICROSOFT, without FORCESEEK.
+  /// @version    2026-10-18/GGB - Function created.
 
-        for (auto const &element : setFields)
+  std::string sqlWriter::createTableHints(identifierPair const &table) const
+  {
+    std::string returnValue;
+    std::vector<std::string> tableHints;
+
+    if ((dialect == MYSQL) || (dialect == MICROSOFT))
+    {
+      for (auto const &element : indexHints)
+      {
+        if ((element.tableName == table.first.str()) || (!table.second.empty() && (element.tableName == table.second.str())))
         {
-          if (firstValue)
-          {
-            firstValue = false;
-          }
-          else
+          std::string indexes;
+
+          for (auto const &index : element.indexes)
           {
-            fieldValues += ", ";
+            if (!indexes.empty())
+            {
+              indexes += ", ";
+            };
+            indexes += quoteName(index);
           };
-          fieldValues+= getColumnMap(element.first) + " = ";
 
-          if (element.second.type() == typeid(std::string))
+          if (dialect == MYSQL)
+          {
+            switch (element.hint)
+            {
+              case HINT_USE_INDEX:
+              {
+                returnValue += " USE INDEX (" + indexes + ")";
+                break;
+              };
+              case HINT_FORCE_INDEX:
+              {
+                returnValue += " FORCE INDEX (" + indexes + ")";
+                break;
+              };
+              case HINT_IGNORE_INDEX:
+              {
+                returnValue += " IGNORE INDEX (" + indexes + ")";
+                break;
+              };
+              default:
+              {
+                CODE_ERROR;
+                break;
+              };
+            };
+          }
+          else if (element.hint == HINT_IGNORE_INDEX)
           {
-            fieldValues += "'" + element.second.to_string() + "'";
+            RUNTIME_ERROR(boost::locale::translate("IGNORE INDEX is not supported for MICROSOFT."), E_SQLWRITER_NOTSUPPORTED,
+                          LIBRARYNAME);
           }
           else
           {
-            fieldValues += element.second.to_string();
+            tableHints.push_back("INDEX(" + indexes + ")");     // The INDEX table hint already forces the index.
           };
         };
+      };
 
-        returnValue += fieldValues;
-
-        break;
-      }
-      default:
+      if (!tableHints.empty())
       {
-        CODE_ERROR;
-      }
+        returnValue = " WITH (" + boost::algorithm::join(tableHints, ", ") + ")";
+      };
     };
 
     return returnValue;
   }
 
-  /// @brief      Converts the where clause to a string for creating the SQL string.
-  /// @returns    The where clause.
-  /// @throws
-  /// @version    2015-05-24/GGB - Function created.
+  /// @brief      Creates the OPTION clause for the query hints. (MICROSOFT only)
+  /// @returns    The OPTION clause, or an empty string if there are no query hints or the dialect is not MICROSOFT.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
 
-  std::string sqlWriter::createWhereClause() const
+  std::string sqlWriter::createOptionClause() const
   {
-    std::string returnValue = " WHERE ";
-    bool first = true;
-    tripleStorage::const_iterator iterator;
+    std::string returnValue;
 
-    for (iterator = whereFields.begin(); iterator != whereFields.end(); iterator++)
+    if ((dialect == MICROSOFT) && !queryHints.empty())
     {
-      if (first)
-      {
-        first = false;
-      }
-      else
-      {
-        returnValue += " AND ";
-      };
-
-      returnValue += "(";
-      returnValue += getColumnMap(std::get<0>(*iterator));
-      returnValue += " ";
-      returnValue += std::get<1>(*iterator);
-
-      if (std::get<2>(*iterator).type() == typeid(std::string))
-      {
-        returnValue += " '";
-        returnValue += std::get<2>(*iterator).to_string();
-        returnValue += "')";
-      }
-      else
-      {
-        returnValue += " ";
-        returnValue += std::get<2>(*iterator).to_string();
-        returnValue += ")";
-      }
+      returnValue = "OPTION (" + boost::algorithm::join(queryHints.get(), ", ") + ")";
     };
 
     return returnValue;
@@ -479,27 +2491,404 @@ namespace GCL
   /// @param[in]  fromString: The table name to add to the from clause.
   /// @param[in]  alias: The alias to use for the table name.
   /// @returns    (*this)
-  /// @throws     None.
+  /// @throws     GCL::runtime_error (If validation is enabled)
+  /// @version    2026-10-18/GGB - Validate the table name.
   /// @version    2017-08-20/GGB - Function created.
 
   sqlWriter &sqlWriter::from(std::string const &fromString, std::string const &alias)
   {
+    if (validateNames_)
+    {
+      fromTableIDs.push_back(resolveTable(fromString));
+    };
     fromFields.emplace_back(fromString, alias);
 
+    if (validateNames_)
+    {
+      resolveSelectColumns();
+    };
+
     return (*this);
   }
 
   /// @brief        Searches the databaseMap and determines the mapped column names.
-  /// @param[in/out] columnName: The columnName to map.
-  /// @returns      true - If the columnName was mapped succesfully.
-  /// @returns      false - The columnName is not recognised in the databaseMap.
-  /// @throws       None.
-  /// @version
-  /// @todo         Implement this function. (Bug# 0000193)
+  /// @param[in]    columnName: The columnName to map. This may be qualified with a table name. (table.column)
+  /// @returns      The mapped column name. If the column is not recognised in the databaseMap, the columnName is returned
+  ///               unchanged.
+  /// @throws       std::bad_alloc
+  /// @version      2026-10-18/GGB - Quote the names if quoting is enabled.
+  /// @version      2026-10-18/GGB - Implemented using the hashed database map. (Bug# 0000193)
 
   std::string sqlWriter::getColumnMap(std::string const &columnName) const
   {
-    std::string returnValue = columnName;
+    std::string returnValue;
+
+    if (databaseMap_->empty())
+    {
+      returnValue = quoteName(columnName);
+    }
+    else
+    {
+      std::string_view column(columnName);
+      std::size_t dotPosn = column.find('.');
+      std::optional<CDatabaseMap::columnID_t> columnID = databaseMap_->findColumn(column);
+
+      if (columnID)
+      {
+        if (dotPosn != std::string_view::npos)
+        {
+          returnValue = quoteName(databaseMap_->mappedTableName(databaseMap_->column(*columnID).tableID));
+          returnValue += '.';
+        };
+        returnValue += quoteName(databaseMap_->mappedColumnName(*columnID));
+      }
+      else if (dotPosn != std::string_view::npos)
+      {
+          // Column not known, but the table may still be mapped. (eg table.*)
+
+        returnValue = getTableMap(columnName.substr(0, dotPosn));
+        returnValue += '.';
+        returnValue += quoteName(column.substr(dotPosn + 1));
+      }
+      else
+      {
+        returnValue = quoteName(columnName);
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Calculates the structural fingerprint of the current builder state. All fields that affect the rendered query
+  ///             are included.
+  /// @returns    The fingerprint.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - The database map version is included.
+  /// @version    2026-10-18/GGB - Values are hashed from their raw bytes and type. Validation is included.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::fingerprint_t sqlWriter::fingerprint() const
+  {
+    fingerprintHasher hasher;
+
+    hasher.add(static_cast<std::uint64_t>(queryType));
+    hasher.add(static_cast<std::uint64_t>(dialect));
+    hasher.add(static_cast<std::uint64_t>(distinct_));
+    hasher.add(static_cast<std::uint64_t>(quoteIdentifiers_));
+    hasher.add(static_cast<std::uint64_t>(validateNames_));
+    hasher.add(databaseMap_->version());
+
+    hasher.add(static_cast<std::uint64_t>(selectFields.size()));
+    for (auto const &element : selectFields)
+    {
+      hasher.add(element.key());
+    };
+
+    hasher.add(static_cast<std::uint64_t>(fromFields.size()));
+    for (auto const &element : fromFields)
+    {
+      hasher.add(element.first.key());
+      hasher.add(element.second.key());
+    };
+
+    hasher.add(static_cast<std::uint64_t>(whereFields.size()));
+    for (auto const &element : whereFields)
+    {
+      hasher.add(std::get<0>(element));
+      hasher.add(std::get<1>(element));
+      hasher.addParameter(std::get<2>(element));
+    };
+
+    hasher.add(insertTable);
+    hasher.add(static_cast<std::uint64_t>(valueFields.size()));
+    for (auto const &row : valueFields)
+    {
+      hasher.add(static_cast<std::uint64_t>(row.size()));
+      for (auto const &element : row)
+      {
+        hasher.addParameter(element);
+      };
+    };
+
+    hasher.add(static_cast<std::uint64_t>(orderByFields.size()));
+    for (auto const &element : orderByFields)
+    {
+      hasher.add(element.first);
+      hasher.add(static_cast<std::uint64_t>(element.second));
+    };
+
+    hasher.add(static_cast<std::uint64_t>(joinFields.size()));
+    for (auto const &element : joinFields)
+    {
+      hasher.add(std::get<0>(element).key());
+      hasher.add(std::get<1>(element).key());
+      hasher.add(static_cast<std::uint64_t>(std::get<2>(element)));
+      hasher.add(std::get<3>(element).key());
+      hasher.add(std::get<4>(element).key());
+    };
+
+    hasher.add(offsetValue);
+    hasher.add(limitValue);
+    hasher.add(countValue);
+
+    hasher.add(static_cast<std::uint64_t>(minFields.size()));
+    for (auto const &element : minFields)
+    {
+      hasher.add(element.first);
+      hasher.add(element.second);
+    };
+
+    hasher.add(static_cast<std::uint64_t>(maxFields.size()));
+    for (auto const &element : maxFields)
+    {
+      hasher.add(element.first);
+      hasher.add(element.second);
+    };
+
+    hasher.add(static_cast<std::uint64_t>(aggregateFields.size()));
+    for (auto const &element : aggregateFields)
+    {
+      hasher.add(static_cast<std::uint64_t>(std::get<0>(element)));
+      hasher.add(std::get<1>(element));
+      hasher.add(std::get<2>(element));
+    };
+
+    hasher.add(static_cast<std::uint64_t>(groupByRollup));
+    hasher.add(static_cast<std::uint64_t>(groupByFields.size()));
+    for (auto const &element : groupByFields)
+    {
+      hasher.add(element);
+    };
+
+    hasher.add(static_cast<std::uint64_t>(havingFields.size()));
+    for (auto const &element : havingFields)
+    {
+      hasher.add(std::get<0>(element) ? static_cast<std::uint64_t>(*std::get<0>(element)) + 1 : 0);
+      hasher.add(std::get<1>(element));
+      hasher.add(std::get<2>(element));
+      hasher.addParameter(std::get<3>(element));
+    };
+
+    hasher.add(static_cast<std::uint64_t>(commonTables.size()));
+    for (auto const &element : commonTables)
+    {
+      hasher.add(element.name);
+      hasher.add(static_cast<std::uint64_t>(element.columns.size()));
+      for (auto const &column : element.columns)
+      {
+        hasher.add(column);
+      };
+      hasher.add(element.query);
+      hasher.add(static_cast<std::uint64_t>(element.recursive));
+    };
+
+    hasher.add(static_cast<std::uint64_t>(windowFields.size()));
+    for (auto const &element : windowFields)
+    {
+      hasher.add(static_cast<std::uint64_t>(element.function));
+      hasher.add(static_cast<std::uint64_t>(element.aggregate));
+      hasher.add(element.column);
+      hasher.add(static_cast<std::uint64_t>(element.partitionBy.size()));
+      for (auto const &column : element.partitionBy)
+      {
+        hasher.add(column);
+      };
+      hasher.add(static_cast<std::uint64_t>(element.orderBy.size()));
+      for (auto const &column : element.orderBy)
+      {
+        hasher.add(column.first);
+        hasher.add(static_cast<std::uint64_t>(column.second));
+      };
+      hasher.add(element.alias);
+    };
+
+    hasher.add(static_cast<std::uint64_t>(indexHints.size()));
+    for (auto const &element : indexHints)
+    {
+      hasher.add(element.tableName);
+      hasher.add(static_cast<std::uint64_t>(element.hint));
+      hasher.add(static_cast<std::uint64_t>(element.indexes.size()));
+      for (auto const &index : element.indexes)
+      {
+        hasher.add(index);
+      };
+    };
+    hasher.add(static_cast<std::uint64_t>(queryHints.size()));
+    for (auto const &element : queryHints)
+    {
+      hasher.add(element);
+    };
+
+    hasher.add(updateTable);
+    hasher.add(static_cast<std::uint64_t>(setFields.size()));
+    for (auto const &element : setFields)
+    {
+      hasher.add(element.first);
+      hasher.addParameter(element.second);
+    };
+
+    hasher.add(deleteTable);
+    hasher.add(batchKey);
+    hasher.add(static_cast<std::uint64_t>(bulkFormat));
+    hasher.add(bulkFileName);
+
+    hasher.add(static_cast<std::uint64_t>(predicateArena.size()));
+    for (auto const &element : predicateArena)
+    {
+      hasher.add(static_cast<std::uint64_t>(element.predicateType));
+      hasher.add(element.columnName);
+      hasher.add(element.operatorString);
+      hasher.add(element.subQuery);
+      hasher.add(element.first);
+      hasher.add(element.count);
+    };
+    for (auto const &element : predicateChildren)
+    {
+      hasher.add(element);
+    };
+    for (auto const &element : predicateValues)
+    {
+      hasher.addParameter(element);
+    };
+    hasher.add(static_cast<std::uint64_t>(wherePredicates.size()));
+    for (auto const &element : wherePredicates)
+    {
+      hasher.add(element.index);
+    };
+    hasher.add(inListLimit);
+
+    hasher.add(static_cast<std::uint64_t>(keysetOrder));
+    hasher.add(static_cast<std::uint64_t>(keysetFields.size()));
+    for (auto const &element : keysetFields)
+    {
+      hasher.add(element);
+    };
+    hasher.add(static_cast<std::uint64_t>(keysetValues.size()));
+    for (auto const &element : keysetValues)
+    {
+      hasher.addParameter(element);
+    };
+
+    return hasher.value();
+  }
+
+  /// @brief      Returns the mapped name of a column in a clause. The resolved reference is used if there is one, otherwise the
+  ///             name is looked up with getColumnMap().
+  /// @param[in]  columnName: The column name.
+  /// @param[in]  refs: The resolved references for the clause.
+  /// @param[in]  index: The index of the column in the clause.
+  /// @param[in]  count: The number of entries in the clause. The references are only used if they match the clause.
+  /// @returns    The mapped column name.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::mappedColumn(std::string const &columnName, columnRefStorage_t const &refs, std::size_t index,
+                                      std::size_t count) const
+  {
+    std::string returnValue;
+
+    if ((refs.size() == count) && refs[index])
+    {
+      SColumnRef const &ref = *refs[index];
+
+      switch (ref.qualifier)
+      {
+        case SColumnRef::q_table:
+        {
+          returnValue = quoteName(databaseMap_->mappedTableName(databaseMap_->column(ref.columnID).tableID));
+          returnValue += '.';
+          break;
+        };
+        case SColumnRef::q_alias:
+        {
+          returnValue = quoteName(std::string_view(columnName).substr(0, columnName.find('.')));
+          returnValue += '.';
+          break;
+        };
+        default:
+        {
+          break;
+        };
+      };
+      returnValue += quoteName(databaseMap_->mappedColumnName(ref.columnID));
+    }
+    else
+    {
+      returnValue = getColumnMap(columnName);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Returns the mapped, qualified name of a column in a join condition.
+  /// @param[in]  tableName: The table name or an alias from the FROM clause.
+  /// @param[in]  columnName: The column name.
+  /// @returns    The mapped name. (table.column) An alias is output unchanged, but the column is mapped through the aliased
+  ///             table. Names that are not in the database map are output unchanged.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::mappedJoinColumn(identifier const &tableName, identifier const &columnName) const
+  {
+    std::string returnValue;
+    std::optional<CDatabaseMap::tableID_t> tableID;
+
+    if (databaseMap_->empty())
+    {
+      returnValue = identifierString(tableName);
+    }
+    else if ((tableID = databaseMap_->findTable(tableName.str())))
+    {
+      returnValue = quoteName(databaseMap_->mappedTableName(*tableID));
+    }
+    else
+    {
+      returnValue = identifierString(tableName);
+
+      for (auto const &element : fromFields)
+      {
+        if (element.second == tableName)
+        {
+          tableID = databaseMap_->findTable(element.first.str());
+          break;
+        };
+      };
+    };
+
+    returnValue += '.';
+
+    std::optional<CDatabaseMap::columnID_t> columnID;
+
+    if (tableID && (columnID = databaseMap_->findColumn(*tableID, columnName.str())))
+    {
+      returnValue += quoteName(databaseMap_->mappedColumnName(*columnID));
+    }
+    else
+    {
+      returnValue += identifierString(columnName);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Returns a table or column name as it is output.
+  /// @param[in]  name: The name.
+  /// @returns    The name quoted for the dialect if quoting is enabled, otherwise the name unchanged.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::quoteName(std::string_view name) const
+  {
+    std::string returnValue;
+
+    if (quoteIdentifiers_)
+    {
+      returnValue = identifier::quote(name, dialect);
+    }
+    else
+    {
+      returnValue = name;
+    };
 
     return returnValue;
   }
@@ -540,48 +2929,27 @@ namespace GCL
 
   bool sqlWriter::createColumn(std::string const &tableName, std::string const &columnName)
   {
-    TDatabaseMap::iterator iter;
+    bool returnValue = false;
+    std::optional<CDatabaseMap::tableID_t> tableID = databaseMap_->findTable(tableName);
 
-    if ( (iter = databaseMap.find(tableName)) == databaseMap.end() )
-    {
-      return false;
-    }
-    else if ( (*iter).second.columnData.find(columnName) != (*iter).second.columnData.end() )
-    {
-      return false;
-    }
-    else
+    if (tableID)
     {
-      SColumnData columnData;
-      columnData.columnName.first = columnName;
-
-      (*iter).second.columnData[columnName] = columnData;
-      return true;
+      returnValue = mutableDatabaseMap().createColumn(*tableID, columnName).has_value();
     };
+
+    return returnValue;
   }
 
   /// @brief Function to add a table to the database map.
   /// @param[in] tableName: The table name.
   /// @returns true =
   /// @note The table is not yet mapped at this point.
+  /// @version 2026-10-18/GGB - Use the hashed database map.
   /// @version 2013-01-26/GGB - Function created.
 
   bool sqlWriter::createTable(std::string const &tableName)
   {
-    // Check if the table already exists in the database.
-
-    if ( (databaseMap.find(tableName) != databaseMap.end()) )
-    {
-      return false;
-    }
-    else
-    {
-      STableData newTable;
-      newTable.tableName.first = tableName;
-
-      databaseMap[tableName] = newTable;
-      return true;
-    };
+    return mutableDatabaseMap().createTable(tableName).has_value();
   }
 
   /// @brief Sets the Mapping of a specified column.
@@ -589,16 +2957,20 @@ namespace GCL
   /// @param[in] columnName: The column name to map.
   /// @param[in] columnMap: The columnName to use when referring to the columnName.
   /// @throws None.
+  /// @version 2026-10-18/GGB - Use the hashed database map. Single lookup per name.
   /// @version 2013-01-26/GGB - Function created.
 
   void sqlWriter::setColumnMap(std::string const &tableName, std::string const &columnName, std::string const &columnMap)
   {
-    if ( databaseMap.find(tableName) != databaseMap.end() )
+    std::optional<CDatabaseMap::tableID_t> tableID = databaseMap_->findTable(tableName);
+
+    if (tableID)
     {
-      if ( databaseMap[tableName].columnData.find(columnName) != databaseMap[tableName].columnData.end() )
+      std::optional<CDatabaseMap::columnID_t> columnID = databaseMap_->findColumn(*tableID, columnName);
+
+      if (columnID)
       {
-        databaseMap[tableName].columnData[columnName].columnName.first = columnName;
-        databaseMap[tableName].columnData[columnName].columnName.second = columnMap;
+        mutableDatabaseMap().setColumnMap(*columnID, columnMap);
       };
     };
   }
@@ -606,48 +2978,68 @@ namespace GCL
   /// @brief Sets the Mapping of the table.
   /// @param[in] tableName: The name of the table.
   /// @param[in] tableMap: The string to map to the tableName.
+  /// @version 2026-10-18/GGB - Use the hashed database map. Single lookup per name.
   /// @version 2013-01-26/GGB - Function created.
 
   void sqlWriter::setTableMap(std::string const &tableName, std::string const &tableMap)
   {
-    if ( databaseMap.find(tableName) != databaseMap.end() )
+    std::optional<CDatabaseMap::tableID_t> tableID = databaseMap_->findTable(tableName);
+
+    if (tableID)
     {
-      databaseMap[tableName].tableName.first = tableName;
-      databaseMap[tableName].tableName.second = tableMap;
+      mutableDatabaseMap().setTableMap(*tableID, tableMap);
     };
   }
 
   /// @brief Output the "FROM" clause as a string.
   /// @returns A string representation of the "FROM" clause.
+  /// @version 2026-10-18/GGB: ORACLE table aliases are written without AS.
+  /// @version 2026-10-18/GGB: Added index hints.
+  /// @version 2026-10-18/GGB: Tables and aliases are held as identifiers.
+  /// @version 2026-10-18/GGB: Bug #195 - Table aliases were not output.
   /// @version 2016-05-08/GGB: Added support for table alisases and table maps.
   /// @version 2015-04-12/GGB: Function created.
 
   std::string sqlWriter::createFromClause() const
   {
     std::string returnValue = " FROM ";
-    std::string tableName;
-    std::string tableAlias;
     bool first = true;
-    std::vector<std::string>::const_iterator iterator;
 
-    first = true;
-    for (auto element : fromFields)
-    {
-      if (first)
+    for (std::size_t index = 0; index < fromFields.size(); index++)
+    {
+      identifierPair const &element = fromFields[index];
+
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        returnValue += ", ";
+      };
+
+      if ((fromTableIDs.size() == fromFields.size()) && fromTableIDs[index])
       {
-        first = false;
+        returnValue += quoteName(databaseMap_->mappedTableName(*fromTableIDs[index]));
+      }
+      else if (databaseMap_->empty())
+      {
+        returnValue += identifierString(element.first);
       }
       else
       {
-        returnValue += ", ";
+        returnValue += getTableMap(element.first.str());
       };
-      tableName = element.first;
 
-      returnValue += tableName;
+      if (!element.second.empty())
+      {
+        returnValue += aliasKeyword();
+        returnValue += identifierString(element.second);
+      };
 
-      if (element.second.length() != 0)
+      if (!indexHints.empty())
       {
-        returnValue += " AS " + tableAlias;
+        returnValue += createTableHints(element);
       };
     }
 
@@ -656,24 +3048,27 @@ namespace GCL
 
   /// @brief Creates the "JOIN" clause
   /// @returns A string containing the join clause (begins with the JOIN keyword.
+  /// @version 2026-10-18/GGB - Tables and columns are mapped through the database map.
+  /// @version 2026-10-18/GGB - Tables and columns are held as identifiers.
+  /// @version 2026-10-18/GGB - Bug #196 - FULL JOIN was not preceded by a space.
   /// @version 2017-07-29/GGB - Function created.
 
   std::string sqlWriter::createJoinClause() const
   {
     std::string returnValue;
 
-    for (auto element : joinFields)
+    for (auto const &element : joinFields)
     {
       switch (std::get<2>(element))
       {
         case JOIN_LEFT:
         {
-          returnValue += + " LEFT JOIN ";
+          returnValue += " LEFT JOIN ";
           break;
         };
         case JOIN_RIGHT:
         {
-          returnValue += + " RIGHT JOIN ";
+          returnValue += " RIGHT JOIN ";
           break;
         };
         case JOIN_INNER:
@@ -683,7 +3078,7 @@ namespace GCL
         }
         case JOIN_FULL:
         {
-          returnValue += "FULL JOIN ";
+          returnValue += " FULL JOIN ";
           break;
         }
         default:
@@ -693,8 +3088,18 @@ namespace GCL
         }
 
       };
-      returnValue += std::get<3>(element) + " ON ";
-      returnValue += std::get<0>(element) + "." + std::get<1>(element) + "=" + std::get<3>(element) + "." + std::get<4>(element);
+      if (databaseMap_->empty())
+      {
+        returnValue += identifierString(std::get<3>(element));
+      }
+      else
+      {
+        returnValue += getTableMap(std::get<3>(element).str());
+      };
+      returnValue += " ON ";
+      returnValue += mappedJoinColumn(std::get<0>(element), std::get<1>(element));
+      returnValue += '=';
+      returnValue += mappedJoinColumn(std::get<3>(element), std::get<4>(element));
     }
 
     return returnValue;
@@ -703,6 +3108,7 @@ namespace GCL
   /// @brief Creates the "ORDER BY" clause.
   /// @returns A string representation of the "Order By" clause.
   /// @throws None.
+  /// @version 2026-10-18/GGB - Bug #197 - Terms were separated by " , ".
   /// @version 2015-04-12/GGB - Function created.
 
   std::string sqlWriter::createOrderByClause() const
@@ -722,18 +3128,18 @@ namespace GCL
       {
         returnValue += ", ";
       };
-      returnValue += getColumnMap((*iterator).first);
-      returnValue += " ";
+      returnValue += mappedColumn((*iterator).first, orderByColumnRefs, iterator - orderByFields.begin(), orderByFields.size());
 
       if ((*iterator).second == ASC)
       {
-        returnValue += "ASC ";
+        returnValue += " ASC";
       }
       else if ((*iterator).second == DESC)
       {
-        returnValue += "DESC ";
+        returnValue += " DESC";
       };
     };
+    returnValue += " ";
 
     return returnValue;
   }
@@ -742,6 +3148,8 @@ namespace GCL
   /// @returns A string representation of the select clause.
   /// @note This function also performs the mapping to the correct table.columnNames. Additionally, if only the columnName is
   ///       given the function will also search the correct tableName or tableAlias and add that to the term.
+  /// @version 2026-10-18/GGB - DISTINCT is written before TOP n.
+  /// @version 2026-10-18/GGB - Added support for aggregate(), window() and hints.
   /// @version 2017-08-20/GGB - Added support for min() and max()
   /// @version 2017-08-19/GGB - Added support for DISTINCT
   /// @version 2017-08-12/GGB - Added code to support COUNT() clauses.
@@ -751,12 +3159,11 @@ namespace GCL
   {
     std::string returnValue = "SELECT ";
     bool first = true;
-    std::vector<std::string>::const_iterator iterator;
-    std::string columnName;
+    std::size_t index;
 
-    if ( (dialect == MICROSOFT) && (limitValue))
+    if ((dialect == MYSQL) || (dialect == ORACLE))
     {
-      returnValue += "TOP " + std::to_string(*limitValue) + " ";
+      returnValue += createHintComment();
     };
 
     if (distinct_)
@@ -764,7 +3171,12 @@ namespace GCL
       returnValue += "DISTINCT ";
     };
 
-    for (iterator = selectFields.begin(); iterator != selectFields.end(); iterator++)
+    if ( (dialect == MICROSOFT) && limitValue && !offsetValue)
+    {
+      returnValue += "TOP " + std::to_string(*limitValue) + " ";
+    };
+
+    for (index = 0; index < selectFields.size(); index++)
     {
       if (first)
       {
@@ -774,9 +3186,15 @@ namespace GCL
       {
         returnValue += ", ";
       };
-      columnName = (*iterator);
 
-      returnValue += columnName;
+      if (databaseMap_->empty())
+      {
+        returnValue += identifierString(selectFields[index]);
+      }
+      else
+      {
+        returnValue += mappedColumn(selectFields[index].str(), selectColumnRefs, index, selectFields.size());
+      };
     };
 
     if (countValue)
@@ -842,12 +3260,48 @@ namespace GCL
       }
     };
 
+    for (index = 0; index < aggregateFields.size(); index++)
+    {
+      aggregate_t const &element = aggregateFields[index];
+
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        returnValue += ", ";
+      };
+
+      returnValue += aggregateString(std::get<0>(element), std::get<1>(element), aggregateColumnRefs, index, aggregateFields.size());
+      if (!std::get<2>(element).empty())
+      {
+        returnValue += " AS " + quoteName(std::get<2>(element));
+      };
+    };
+
+    for (auto const &element : windowFields)
+    {
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        returnValue += ", ";
+      };
+
+      returnValue += windowString(element);
+    };
+
     return returnValue;
   }
 
   /// @brief      Produces the string for a SELECT query.
   /// @returns    A string containing the select clause.
   /// @throws     None.
+  /// @version    2026-10-18/GGB - Added the WITH, GROUP BY, HAVING and OPTION clauses and POSTGRE hints.
+  /// @version    2026-10-18/GGB - Added keyset pagination and MICROSOFT OFFSET support.
   /// @version    2020-04-25/GGB - Added support for the LIMIT and OFFSET clauses.
   /// @version    2017-08-12/GGB - Added check for countValue in selectClause if statement.
   /// @version    2015-03-30/GGB - Function created.
@@ -856,8 +3310,18 @@ namespace GCL
   {
     std::string returnValue;
 
+    if (dialect == POSTGRE)
+    {
+      returnValue += createHintComment();
+    };
+
+    if (!commonTables.empty())
+    {
+      returnValue += createWithClause();
+    };
+
     if ( !selectFields.empty() || countValue ||
-         !maxFields.empty() || !minFields.empty() )
+         !maxFields.empty() || !minFields.empty() || !aggregateFields.empty() || !windowFields.empty() )
     {
       returnValue += createSelectClause();
     }
@@ -882,24 +3346,59 @@ namespace GCL
       returnValue += createJoinClause();
     }
 
-    if (!whereFields.empty())
+    if (!whereFields.empty() || !keysetValues.empty() || !wherePredicates.empty())
     {
       returnValue += createWhereClause();
     };
 
+    if (!groupByFields.empty())
+    {
+      returnValue += createGroupByClause();
+    };
+
+    if (!havingFields.empty())
+    {
+      returnValue += createHavingClause();
+    };
+
     if (!orderByFields.empty())
     {
       returnValue += createOrderByClause();
+    }
+    else if ((dialect == MICROSOFT) && offsetValue)
+    {
+      returnValue += " ORDER BY (SELECT NULL) ";   // OFFSET ... FETCH requires an ORDER BY clause.
+    };
+
+    std::string limitClause = createLimitClause();
+
+    if (!limitClause.empty())
+    {
+      if (returnValue.back() != ' ')
+      {
+        returnValue += " ";
+      };
+      returnValue += limitClause;
     };
 
-    returnValue += createLimitClause();
+    std::string optionClause = createOptionClause();
+
+    if (!optionClause.empty())
+    {
+      if (returnValue.back() != ' ')
+      {
+        returnValue += " ";
+      };
+      returnValue += optionClause;
+    };
 
     return returnValue;
   }
 
   /// @brief Constructor for the from clause.
   /// @param[in] fields: The fields to add to the from clause.
-  /// @throws None.
+  /// @throws GCL::runtime_error (If validation is enabled)
+  /// @version 2026-10-18/GGB - Validate the table names.
   /// @version 2017-08-20/GGB - Added support for aliases.
   /// @version 2015-03-30/GGB - Function created.
 
@@ -907,9 +3406,18 @@ namespace GCL
   {
     for (auto elem : fields)
     {
+      if (validateNames_)
+      {
+        fromTableIDs.push_back(resolveTable(elem));
+      };
       fromFields.emplace_back(elem, "");
     }
 
+    if (validateNames_)
+    {
+      resolveSelectColumns();
+    };
+
     return (*this);
   }
 
@@ -929,11 +3437,87 @@ namespace GCL
 
     queryType = qt_delete;
 
+    if (validateNames_)
+    {
+      resolveTable(tableName);
+    };
+
     deleteTable = tableName;
 
     return *this;
   }
 
+  /// @brief      Adds columns to the GROUP BY clause. @c groupBy({"region", "product"})
+  /// @param[in]  fields: The columns to group by.
+  /// @param[in]  rollup: true - Add subtotal and total rows with ROLLUP.
+  /// @returns    (*this)
+  /// @throws     GCL::runtime_error (If validation is enabled)
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::groupBy(std::initializer_list<std::string> fields, bool rollup)
+  {
+    for (auto const &element : fields)
+    {
+      addColumnRef(groupByColumnRefs, element);
+      groupByFields.push_back(element);
+    };
+    groupByRollup = groupByRollup || rollup;
+
+    return (*this);
+  }
+
+  /// @brief      Adds a condition on an aggregate to the HAVING clause. @c having(AGG_SUM, "amount", ">", 1000)
+  /// @param[in]  function: The aggregate function.
+  /// @param[in]  column: The column to aggregate.
+  /// @param[in]  operatorString: The comparison operator.
+  /// @param[in]  value: The value to compare with.
+  /// @returns    (*this)
+  /// @throws     GCL::runtime_error (If validation is enabled)
+  /// @version    2026-10-18/GGB - The column is validated.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::having(EAggregate function, std::string const &column, std::string const &operatorString,
+                               parameter const &value)
+  {
+    addColumnRef(havingColumnRefs, column);
+    havingFields.emplace_back(function, column, operatorString, value);
+
+    return (*this);
+  }
+
+  /// @brief      Adds a condition on a grouped column to the HAVING clause. @c having("region", "<>", "north")
+  /// @param[in]  column: The grouped column.
+  /// @param[in]  operatorString: The comparison operator.
+  /// @param[in]  value: The value to compare with.
+  /// @returns    (*this)
+  /// @throws     GCL::runtime_error (If validation is enabled)
+  /// @version    2026-10-18/GGB - The column is validated.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::having(std::string const &column, std::string const &operatorString, parameter const &value)
+  {
+    addColumnRef(havingColumnRefs, column);
+    havingFields.emplace_back(std::nullopt, column, operatorString, value);
+
+    return (*this);
+  }
+
+  /// @brief      Adds an index hint for a table in a select query. @c indexHint("orders", HINT_FORCE_INDEX, {"idx_customer"})
+  /// @param[in]  tableName: The table (or alias) as given to from().
+  /// @param[in]  hint: The type of hint.
+  /// @param[in]  indexes: The indexes.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @note       The hint is output in the position required by the dialect. (See the class documentation)
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::indexHint(std::string const &tableName, EIndexHint hint, std::initializer_list<std::string> indexes)
+  {
+    indexHints.push_back(SIndexHint{tableName, hint, indexes});
+
+    return (*this);
+  }
+
   /// @brief Set the query type to a 'INSERT' query.
   /// @param[in] tableName: The table name to insert into.
   /// @returns *this
@@ -949,6 +3533,11 @@ namespace GCL
 
     queryType = qt_insert;
 
+    if (validateNames_)
+    {
+      resolveTable(tableName);
+    };
+
     insertTable = tableName;
 
     return *this;
@@ -971,10 +3560,16 @@ namespace GCL
 
     queryType = qt_insert;
 
+    if (validateNames_)
+    {
+      resolveTable(tableName);
+    };
+
     insertTable = tableName;
 
     for (auto elem : fields)
     {
+      addColumnRef(selectColumnRefs, elem);
       selectFields.push_back(elem);
     };
 
@@ -997,6 +3592,59 @@ namespace GCL
     return *this;
   }
 
+  /// @brief      Sets up keyset (seek) pagination. The query is ordered on the key columns and limited to the page size. If the
+  ///             last key values are given, only rows after the last key are selected. This avoids the cost of large offsets.
+  /// @param[in]  keyColumns: The columns that make up the (unique) key.
+  /// @param[in]  lastKey: The key values of the last row of the previous page. Empty for the first page.
+  /// @param[in]  pageSize: The number of rows in the page.
+  /// @param[in]  direction: The direction to page in.
+  /// @returns    (*this)
+  /// @throws     GCL::CRuntimeAssert
+  /// @details    @code keyset({"ID"}, {lastID}, 100) @endcode translates to
+  ///             @code WHERE (ID > lastID) ORDER BY ID ASC LIMIT 100 @endcode
+  ///             The key columns are placed first in the ORDER BY clause, before any terms from orderBy(), as the seek
+  ///             predicate is only correct if the rows are ordered on the key. The key columns of an earlier call are replaced.
+  /// @version    2026-10-18/GGB - Key columns are placed first in the ORDER BY clause.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::keyset(std::initializer_list<std::string> keyColumns, parameterStorage const &lastKey,
+                               std::uint64_t pageSize, EOrderBy direction)
+  {
+    RUNTIME_ASSERT(keyColumns.size() != 0, boost::locale::translate("Keyset pagination requires at least one key column."));
+    RUNTIME_ASSERT(lastKey.empty() || (lastKey.size() == keyColumns.size()),
+                   boost::locale::translate("Keyset values do not match the key columns."));
+
+    std::vector<orderBy_t> &orderByTerms = orderByFields.mutate();
+    std::size_t previousKeys = keysetFields.size();       // The key columns of an earlier call are at the front.
+
+    orderByTerms.erase(orderByTerms.begin(), orderByTerms.begin() + previousKeys);
+    if ((previousKeys != 0) && (orderByColumnRefs.size() >= previousKeys))
+    {
+      std::vector<std::optional<SColumnRef>> &refs = orderByColumnRefs.mutate();
+      refs.erase(refs.begin(), refs.begin() + previousKeys);
+    };
+
+    keysetFields.mutate().assign(keyColumns);
+    keysetValues.mutate() = lastKey;
+    keysetOrder = direction;
+
+    std::size_t index = 0;
+    for (auto const &column : keyColumns)
+    {
+      if (validateNames_)
+      {
+        std::vector<std::optional<SColumnRef>> &refs = orderByColumnRefs.mutate();
+        refs.insert(refs.begin() + index, resolveColumn(column));
+      };
+      orderByTerms.emplace(orderByTerms.begin() + index, column, direction);
+      index++;
+    };
+
+    limitValue = pageSize;
+
+    return (*this);
+  }
+
   /// @brief  Sets the limit value. This will be interpreted based on the SQL dialect in use.
   /// @param[in] limit: The maximum number of records to return.
   /// @version 2020-04-25/GGB - Changed parameter from std::size_t to std::uint64_t.
@@ -1013,177 +3661,442 @@ namespace GCL
   /// @param[in] offset: The offset of the first record to return.
   /// @version 2020-04-25/GGB - Function created.
 
-  sqlWriter &sqlWriter::offset(std::uint64_t offset)
-  {
-    offsetValue = offset;
-    return (*this);
-  }
+  sqlWriter &sqlWriter::offset(std::uint64_t offset)
+  {
+    offsetValue = offset;
+    return (*this);
+  }
+
+
+  /// @brief Copy the orderBy pairs to the list.
+  /// @param[in] fields: The orderBy Pairs to copy
+  /// @returns *this
+  /// @throws None.
+  /// @version 2019-10-24/GGB - Changed the orderBy type and storage.
+  /// @version 2015-04-12/GGB - Function created.
+
+  sqlWriter &sqlWriter::orderBy(std::initializer_list<std::pair<std::string, EOrderBy>> fields)
+  {
+    for (auto elem : fields)
+    {
+      addColumnRef(orderByColumnRefs, elem.first);
+      orderByFields.push_back(elem);
+    };
+
+    return *this;
+  }
+
+  /// @brief      Adds an optimiser hint to a select query. The hint is passed to the database unchanged.
+  ///             @c queryHint("MAX_EXECUTION_TIME(1000)") (MYSQL) or @c queryHint("MAXDOP 1") (MICROSOFT)
+  /// @param[in]  hint: The hint.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @note       MICROSOFT hints are output in the OPTION clause. The other dialects output the hints in a /*+ ... */ comment.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::queryHint(std::string const &hint)
+  {
+    queryHints.push_back(hint);
+
+    return (*this);
+  }
+
+  /// @brief      Function to load a map file and store all the aliases.
+  /// @param[in]  ifn: The file to read the database mapping from.
+  /// @throws     GCL::CRuntimeError
+  /// @note       The file is memory mapped and parsed in a single pass. Tokens are string_views into the mapped file, so the only
+  ///             copies made are of the mapped names that are stored.
+  /// @version    2026-10-18/GGB - Changed to a single pass parser over a memory mapped file.
+  /// @version    2013-01-26/GGB - Function created.
+
+  void sqlWriter::readMapFile(boost::filesystem::path const &ifn)
+  {
+    boost::interprocess::file_mapping mapFile;
+    boost::interprocess::mapped_region mapRegion;
+    std::string_view fileText;
+    CDatabaseMap::tableID_t currentTable = 0;
+    bool tableInForce = false;                    // Set between a TABLE and its END directive.
+    std::size_t lineNumber = 1;
+
+    try
+    {
+      if (boost::filesystem::file_size(ifn) != 0)
+      {
+        mapFile = boost::interprocess::file_mapping(ifn.c_str(), boost::interprocess::read_only);
+        mapRegion = boost::interprocess::mapped_region(mapFile, boost::interprocess::read_only);
+        fileText = std::string_view(static_cast<char const *>(mapRegion.get_address()), mapRegion.get_size());
+      };
+    }
+    catch(std::exception const &)
+    {
+      RUNTIME_ERROR("Could not open SQL map file:" + ifn.native());
+    };
+
+    while (!fileText.empty())
+    {
+      std::size_t lineEnd = fileText.find('\n');
+      std::string_view textLine = fileText.substr(0, lineEnd);
+
+      fileText.remove_prefix(lineEnd == std::string_view::npos ? fileText.size() : lineEnd + 1);
+
+      if (!textLine.empty() && textLine.back() == '\r')
+      {
+        textLine.remove_suffix(1);
+      };
+
+      if ( (textLine.size() > 1) && (textLine[0] != ';') )
+      {
+        std::string_view szCommand = trimView(textLine.substr(0, textLine.find(' ')));
+        std::size_t equalPosn = textLine.find('=');
+        std::size_t token1S = textLine.find('[');
+        std::size_t token1E = textLine.find(']');
+        std::size_t token2S = textLine.find('[', equalPosn);
+        std::size_t token2E = textLine.find(']', equalPosn);
+        std::string_view szToken1, szToken2;
+
+        if (token1S < token1E)
+        {
+          szToken1 = textLine.substr(token1S + 1, token1E - token1S - 1);
+        }
+        else if (szCommand != END)
+        {
+          RUNTIME_ERROR("Error in SQL map file:" + ifn.native() + "Syntax error on line: " +
+                        std::to_string(lineNumber) + " - Needs at least one token.");
+        };
+
+        if (token2S < token2E)
+        {
+          szToken2 = textLine.substr(token2S + 1, token2E - token2S - 1);
+        };
+
+        if (szCommand == COLUMN)
+        {
+          std::optional<CDatabaseMap::columnID_t> columnID;
+
+          if (!tableInForce)
+          {
+            std::clog << "Error in SQL map file: " << ifn << std::endl;
+            std::clog << "Syntax command on line: " << lineNumber
+                      << " - COLUMN directive found, but no TABLE directive in force." << std::endl;
+            RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
+          }
+          else if (szToken1.empty())
+          {
+            std::clog << "Error in SQL map file: " << ifn << std::endl;
+            std::clog << "Syntax command on line: " << lineNumber << " - COLUMN directive found, column name." << std::endl;
+            RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
+          }
+          else if ( !(columnID = databaseMap_->findColumn(currentTable, szToken1)) )
+          {
+            RUNTIME_ERROR("Error in SQL map file: " + ifn.native() +
+                          "Syntax command on line: " + std::to_string(lineNumber) + " - Invalid column name.");
+          }
+          else if (!szToken2.empty())
+          {
+            mutableDatabaseMap().setColumnMap(*columnID, szToken2);
+          };
+        }
+        else if (szCommand == TABLE)
+        {
+          std::optional<CDatabaseMap::tableID_t> tableID;
+
+          if (tableInForce)
+          {
+            std::clog << "Error in SQL map file: " << ifn << std::endl;
+            std::clog << "Syntax command on line: " << lineNumber
+                      << " - TABLE directive found, but a TABLE directive is already specified." << std::endl;
+            RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
+          }
+          else if (szToken1.empty() )
+          {
+            std::clog << "Error in SQL map file: " << ifn << std::endl;
+            std::clog << "Syntax command on line: " << lineNumber << " - TABLE directive found, but no table name." << std::endl;
+            RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
+          }
+          else if ( !(tableID = databaseMap_->findTable(szToken1)) )
+          {
+            std::clog << "Error in SQL map file: " << ifn << std::endl;
+            std::clog << "Error on line: " << lineNumber << " - Invalid Table name." << std::endl;
+            RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Invalid Table Name."), E_SQLWRITER_INVALIDTABLENAME,
+                          LIBRARYNAME);
+          }
+          else
+          {
+            currentTable = *tableID;
+            tableInForce = true;
+
+            if (!szToken2.empty())
+            {
+              mutableDatabaseMap().setTableMap(currentTable, szToken2);  // Add the alias into the record.
+            };
+          };
+        }
+        else if (szCommand == END)
+        {
+          if ( (token1S == std::string_view::npos) &&
+               (token1E == std::string_view::npos) &&
+               (token2S == std::string_view::npos) &&
+               (token2E == std::string_view::npos) &&
+               (equalPosn == std::string_view::npos) )
+          {
+            tableInForce = false;
+          }
+          else
+          {
+            std::clog << "Error in SQL map file: " << ifn << std::endl;
+            std::clog << "Syntax command on line: " << lineNumber << std::endl;
+            RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
+          };
+        }
+        else
+        {
+          std::clog << "Error in SQL map file: " << ifn << std::endl;
+          std::clog << "Invalid command on line: " << lineNumber << std::endl;
+          RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Invalid Command."), E_SQLWRITER_INVALIDCOMMAND, LIBRARYNAME);
+        };
+      };
+
+      lineNumber++;
+    };
+  }
+
+  /// @brief      Renders a number of queries in parallel.
+  /// @param[in]  queries: The queries to render.
+  /// @param[in]  threadCount: The number of threads to use. (0 = one per core)
+  /// @returns    The rendered queries, in the same order as the input.
+  /// @throws     The first exception thrown while rendering.
+  /// @note       Each thread renders a contiguous block of the queries into its own buffer, so the threads do not share any
+  ///             output and there is no allocation per query.
+  /// @version    2026-10-18/GGB - Returns the per-thread buffers instead of a string per query.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::renderedQueries sqlWriter::renderQueries(std::vector<sqlWriter> const &queries, std::size_t threadCount)
+  {
+    renderedQueries returnValue;
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions;
+    std::size_t blockSize;
+
+    if (threadCount == 0)
+    {
+      threadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    };
+    threadCount = std::max<std::size_t>(std::min(threadCount, queries.size()), 1);
+    blockSize = std::max<std::size_t>((queries.size() + threadCount - 1) / threadCount, 1);
+    exceptions.resize(threadCount);
+
+    returnValue.blockSize_ = blockSize;
+    returnValue.buffers_.resize((queries.size() + blockSize - 1) / blockSize);
+    returnValue.offsets_.resize(queries.size());
 
+    for (std::size_t thread = 0; thread < returnValue.buffers_.size(); thread++)
+    {
+      threads.emplace_back([&, thread]()
+      {
+        try
+        {
+          std::string &buffer = returnValue.buffers_[thread];
+          std::size_t last = std::min(queries.size(), (thread + 1) * blockSize);
 
-  /// @brief Copy the orderBy pairs to the list.
-  /// @param[in] fields: The orderBy Pairs to copy
-  /// @returns *this
-  /// @throws None.
-  /// @version 2019-10-24/GGB - Changed the orderBy type and storage.
-  /// @version 2015-04-12/GGB - Function created.
+          for (std::size_t index = thread * blockSize; index < last; index++)
+          {
+            returnValue.offsets_[index] = buffer.size();
+            buffer += queries[index].string();
+          };
+        }
+        catch(...)
+        {
+          exceptions[thread] = std::current_exception();
+        };
+      });
+    };
 
-  sqlWriter &sqlWriter::orderBy(std::initializer_list<std::pair<std::string, EOrderBy>> fields)
-  {
-    for (auto elem : fields)
+    for (auto &element : threads)
     {
-      orderByFields.push_back(elem);
+      element.join();
     };
 
-    return *this;
+    for (auto &element : exceptions)
+    {
+      if (element)
+      {
+        std::rethrow_exception(element);
+      };
+    };
+
+    return returnValue;
   }
 
-  /// @brief      Function to load a map file and store all the aliases.
-  /// @param[in]  ifn: The file to read the database mapping from.
-  /// @throws     GCL::CRuntimeError
-  /// @version    2013-01-26/GGB - Function created.
+  /// @brief      Returns a rendered query.
+  /// @param[in]  index: The index of the query.
+  /// @returns    The query. The view is valid for the lifetime of the object.
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
 
-  void sqlWriter::readMapFile(boost::filesystem::path const &ifn)
+  std::string_view sqlWriter::renderedQueries::operator[](std::size_t index) const
   {
-    std::ifstream ifs;
-    std::string textLine;
-    std::string szCommand;
-    int lineNumber = 1;
-    std::string currentTable;
-    size_t spacePosn, token1S, token1E, token2S, token2E, equalPosn;
-    std::string szToken1, szToken2;
-
-    ifs.open(ifn.string());
+    std::size_t block = index / blockSize_;
+    std::size_t begin = offsets_[index];
+    std::size_t end;
 
-    if (!ifs)
+    if (((index + 1) % blockSize_ == 0) || (index + 1 == offsets_.size()))
     {
-      RUNTIME_ERROR("Could not open SQL map file:" + ifn.native());
+      end = buffers_[block].size();
     }
     else
     {
-      while (ifs.good())
-      {
-        std::getline(ifs, textLine);
-        if ( (textLine.size() > 1) && (textLine[0] != ';') )
-        {
-          spacePosn = textLine.find_first_of(' ', 0);
-          szCommand = textLine.substr(0, spacePosn);
-          boost::trim(szCommand);
-          equalPosn = textLine.find_first_of('=', 0);
-          token1S = textLine.find_first_of('[', 0);
-          token1E = textLine.find_first_of(']', 0);
-          token2S = textLine.find_first_of('[', equalPosn);
-          token2E = textLine.find_first_of(']', equalPosn);
+      end = offsets_[index + 1];
+    };
 
-          if (token1S < token1E)
-          {
-            szToken1 = textLine.substr(token1S + 1, token1E - token1S - 1);
-          }
-          else if (szCommand != END)
-          {
-            RUNTIME_ERROR("Error in SQL map file:" + ifn.native() + "Syntax error on line: " +
-                          std::to_string(lineNumber) + " - Needs at least one token.");
-          };
+    return std::string_view(buffers_[block]).substr(begin, end - begin);
+  }
 
-          if (token2S < token2E)
-          {
-            szToken2 = textLine.substr(token2S + 1, token2E - token2S - 1);
-          }
-          else
-          {
-            szToken2.clear();
-          };
+  /// @brief      Renders a number of queries in parallel and writes them to a stream.
+  /// @param[in]  queries: The queries to render.
+  /// @param[in]  os: The stream to write the queries to.
+  /// @param[in]  threadCount: The number of threads to use. (0 = one per core)
+  /// @param[in]  terminator: Written after each query.
+  /// @throws     The first exception thrown while rendering or writing.
+  /// @note       The queries are rendered in blocks. Each block is rendered by one thread into a single buffer, and the blocks are
+  ///             written in order by the calling thread. At most two blocks per thread are held in memory.
+  /// @version    2026-10-18/GGB - Exceptions writing to the stream stop and join the threads before being rethrown.
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::renderQueries(std::vector<sqlWriter> const &queries, std::ostream &os, std::size_t threadCount,
+                                std::string const &terminator)
+  {
+    std::size_t const BLOCK_SIZE = 1024;
+
+    std::size_t blockCount = (queries.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    std::size_t maxBlocks;
+    std::vector<std::optional<std::string>> blocks(blockCount);
+    std::vector<std::thread> threads;
+    std::mutex blockMutex;
+    std::condition_variable blockReady;         // Signalled when a block has been rendered.
+    std::condition_variable blockWritten;       // Signalled when a block has been written.
+    std::size_t nextBlock = 0;
+    std::size_t writtenBlocks = 0;
+    std::exception_ptr exception;
+
+    if (threadCount == 0)
+    {
+      threadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    };
+    threadCount = std::max<std::size_t>(std::min(threadCount, blockCount), 1);
+    maxBlocks = threadCount * 2;
+
+      // Any exception in the calling thread (creating the threads or writing to the stream) must stop and join the workers
+      // before it is rethrown, as they may be waiting for a block to be written.
 
-          if (szCommand == COLUMN)
+    try
+    {
+      for (std::size_t thread = 0; thread < threadCount; thread++)
+      {
+        threads.emplace_back([&]()
+        {
+          for (;;)
           {
-            if (currentTable.empty())
-            {
-              std::clog << "Error in SQL map file: " << ifn << std::endl;
-              std::clog << "Syntax command on line: " << lineNumber << " - COLUMN directive found, but no TABLE directive in force." << std::endl;
-              RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
-            }
-            else if (szToken1.empty())
-            {
-              std::clog << "Error in SQL map file: " << ifn << std::endl;
-              std::clog << "Syntax command on line: " << lineNumber << " - COLUMN directive found, column name." << std::endl;
-              RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
-            }
-            else if ( (*databaseMap.find(currentTable)).second.columnData.find(szToken1) ==
-                      (*databaseMap.find(currentTable)).second.columnData.end())
-            {
-              RUNTIME_ERROR("Error in SQL map file: " + ifn.native() +
-                            "Syntax command on line: " + std::to_string(lineNumber) + " - Invalid column name.");
-            }
-            else
+            std::size_t block;
+
             {
-              if (!szToken2.empty())
+              std::unique_lock<std::mutex> lock(blockMutex);
+
+              blockWritten.wait(lock, [&]
               {
-                setColumnMap(currentTable, szToken1, szToken2);
+                return exception || (nextBlock >= blockCount) || (nextBlock < writtenBlocks + maxBlocks);
+              });
+
+              if (exception || (nextBlock >= blockCount))
+              {
+                break;
               };
+              block = nextBlock++;
             };
-          }
-          else if (szCommand == TABLE)
-          {
-            if (!currentTable.empty())
-            {
-              std::clog << "Error in SQL map file: " << ifn << std::endl;
-              std::clog << "Syntax command on line: " << lineNumber << " - TABLE directive found, but a TABLE directive is already specified." << std::endl;
-              RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
-            }
-            else if (szToken1.empty() )
-            {
-              std::clog << "Error in SQL map file: " << ifn << std::endl;
-              std::clog << "Syntax command on line: " << lineNumber << " - TABLE directive found, but no table name." << std::endl;
-              RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
-            }
-            else if (databaseMap.find(szToken1) == databaseMap.end())
-            {
-              std::clog << "Error in SQL map file: " << ifn << std::endl;
-              std::clog << "Error on line: " << lineNumber << " - Invalid Table name." << std::endl;
-              RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Invalid Table Name."), E_SQLWRITER_INVALIDTABLENAME,
-                            LIBRARYNAME);
-            }
-            else
+
+            try
             {
-              currentTable = szToken1;
-              if (!szToken2.empty())
+              std::string buffer;
+              std::size_t last = std::min(queries.size(), (block + 1) * BLOCK_SIZE);
+
+              for (std::size_t index = block * BLOCK_SIZE; index < last; index++)
               {
-                setTableMap(currentTable, szToken2);  // Add the alias into the record.
+                buffer += queries[index].string();
+                buffer += terminator;
               };
-            };
-          }
-          else if (szCommand == END)
-          {
-            if ( (token1S == textLine.npos) &&
-                 (token1E == textLine.npos) &&
-                 (token2S == textLine.npos) &&
-                 (token2E == textLine.npos) &&
-                 (equalPosn == textLine.npos) )
-            {
-              currentTable.clear();
+
+              std::lock_guard<std::mutex> lock(blockMutex);
+              blocks[block] = std::move(buffer);
             }
-            else
+            catch(...)
             {
-              std::clog << "Error in SQL map file: " << ifn << std::endl;
-              std::clog << "Syntax command on line: " << lineNumber << std::endl;
-              RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."), E_SQLWRITER_SYNTAXERROR, LIBRARYNAME);
+              std::lock_guard<std::mutex> lock(blockMutex);
+
+              if (!exception)
+              {
+                exception = std::current_exception();
+              };
             };
-          }
-          else
+            blockReady.notify_all();
+            blockWritten.notify_all();
+          };
+        });
+      };
+
+        // Write the blocks in order as they become available.
+
+      for (std::size_t block = 0; block < blockCount; block++)
+      {
+        std::string buffer;
+
+        {
+          std::unique_lock<std::mutex> lock(blockMutex);
+
+          blockReady.wait(lock, [&] { return exception || blocks[block].has_value(); });
+
+          if (exception)
           {
-            std::clog << "Error in SQL map file: " << ifn << std::endl;
-            std::clog << "Invalid command on line: " << lineNumber << std::endl;
-            RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Invalid Command."), E_SQLWRITER_INVALIDCOMMAND, LIBRARYNAME);
+            break;
           };
+          buffer = std::move(*blocks[block]);
+          blocks[block].reset();
+        };
+
+        os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        {
+          std::lock_guard<std::mutex> lock(blockMutex);
+          writtenBlocks++;
         };
+        blockWritten.notify_all();
+      };
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(blockMutex);
 
-        lineNumber++;
+      if (!exception)
+      {
+        exception = std::current_exception();
       };
-      ifs.close();
+    };
+    blockReady.notify_all();
+    blockWritten.notify_all();
+
+    for (auto &element : threads)
+    {
+      element.join();
+    };
+
+    if (exception)
+    {
+      std::rethrow_exception(exception);
     };
   }
 
   /// @brief Resets all the fields for the query.
   /// @throws None.
+  /// @version 2026-10-18/GGB - Added aggregates, GROUP BY, HAVING, common table expressions, window functions and hints.
+  /// @version 2026-10-18/GGB - Added batched updates and bulk loads.
   /// @version 2020-04-25/GGB - Added offsetValue to support offsets.
   /// @version 2019-12-08/GGB - Update queryType = qt_none when the query is reset.
   /// @version 2017-08-19/GGB - Added support for distinct.
@@ -1205,18 +4118,193 @@ namespace GCL
     distinct_ = false;
     maxFields.clear();
     minFields.clear();
+    aggregateFields.clear();
+    groupByFields.clear();
+    groupByColumnRefs.clear();
+    aggregateColumnRefs.clear();
+    havingColumnRefs.clear();
+    groupByRollup = false;
+    havingFields.clear();
+    commonTables.clear();
+    windowFields.clear();
+    indexHints.clear();
+    queryHints.clear();
     updateTable.clear();
     setFields.clear();
+    batchKey.clear();
+    bulkFormat = BULK_TEXT;
+    bulkFileName.clear();
+    keysetFields.clear();
+    keysetValues.clear();
+    selectColumnRefs.clear();
+    setColumnRefs.clear();
+    orderByColumnRefs.clear();
+    fromTableIDs.clear();
+    resetWhere();
     queryType = qt_none;
   }
 
   /// @brief Resets the where clause of a query.
   /// @throws None.
+  /// @note   Any predicate handles are invalidated.
+  /// @version 2026-10-18/GGB - Clear the predicate arena.
   /// @version 2017-08-19/GGB - Function created.
 
   void sqlWriter::resetWhere()
   {
     whereFields.clear();
+    whereColumnRefs.clear();
+    keysetValues.clear();
+    wherePredicates.clear();
+    predicateArena.clear();
+    predicateChildren.clear();
+    predicateValues.clear();
+  }
+
+  /// @brief      Resolves a column name against the database map.
+  /// @param[in]  columnName: The column name. This may be qualified with a table name or a table alias in the from clause.
+  /// @returns    The resolved column. No value is returned for wildcards and expressions, or for unqualified names that are in
+  ///             more than one table and cannot be resolved against the tables already in the query.
+  /// @throws     GCL::runtime_error - The column (or table) is not in the database map.
+  /// @note       This costs at most two hash lookups, plus one per table in the query for an ambiguous name.
+  /// @note       Names qualified with an unknown table are accepted if there are no tables in the from clause yet, as the qualifier
+  ///             may be an alias. These are resolved by from().
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<sqlWriter::SColumnRef> sqlWriter::resolveColumn(std::string const &columnName) const
+  {
+    std::optional<SColumnRef> returnValue;
+    std::string_view column(columnName);
+    std::size_t dotPosn = column.find('.');
+    std::optional<CDatabaseMap::columnID_t> columnID;
+
+    if (column.find_first_of("*(") != std::string_view::npos)
+    {
+        // Wildcards and expressions are not validated.
+    }
+    else if (dotPosn != std::string_view::npos)
+    {
+      std::string_view qualifier = column.substr(0, dotPosn);
+      std::optional<CDatabaseMap::tableID_t> tableID = databaseMap_->findTable(qualifier);
+      SColumnRef::EQualifier qualifierType = SColumnRef::q_table;
+
+      if (!tableID)
+      {
+        for (auto const &element : fromFields)
+        {
+          if (element.second.str() == qualifier)
+          {
+            tableID = databaseMap_->findTable(element.first.str());
+            qualifierType = SColumnRef::q_alias;
+            break;
+          };
+        };
+      };
+
+      if (!tableID && fromFields.empty())
+      {
+          // May be an alias of a table that has not been added yet. Resolved when the table is added. (See from())
+      }
+      else if (!tableID)
+      {
+        RUNTIME_ERROR(std::string(boost::locale::translate("MAPPED SQL WRITER: Invalid table name: ")) + std::string(qualifier),
+                      E_SQLWRITER_INVALIDTABLENAME, LIBRARYNAME);
+      }
+      else if ( !(columnID = databaseMap_->findColumn(*tableID, column.substr(dotPosn + 1))) )
+      {
+        RUNTIME_ERROR(std::string(boost::locale::translate("MAPPED SQL WRITER: Invalid column name: ")) + columnName,
+                      E_SQLWRITER_INVALIDCOLUMNNAME, LIBRARYNAME);
+      }
+      else
+      {
+        returnValue = SColumnRef{*columnID, qualifierType};
+      };
+    }
+    else if ( (columnID = databaseMap_->findColumn(column)) )
+    {
+      returnValue = SColumnRef{*columnID, SColumnRef::q_none};
+    }
+    else if (databaseMap_->hasColumn(column))
+    {
+        // The name is in more than one table. Resolve it against the tables already in the query if it is in only one of them.
+
+      std::vector<std::string const *> tableNames;
+      std::size_t matches = 0;
+
+      for (auto const &element : fromFields)
+      {
+        tableNames.push_back(&element.first.str());
+      };
+      tableNames.push_back(&updateTable);
+      tableNames.push_back(&insertTable);
+      tableNames.push_back(&deleteTable);
+
+      for (auto tableName : tableNames)
+      {
+        std::optional<CDatabaseMap::tableID_t> tableID;
+
+        if (!tableName->empty() && (tableID = databaseMap_->findTable(*tableName)) &&
+            (columnID = databaseMap_->findColumn(*tableID, column)))
+        {
+          returnValue = SColumnRef{*columnID, SColumnRef::q_none};
+          matches++;
+        };
+      };
+
+      if (matches != 1)
+      {
+        returnValue.reset();
+      };
+    }
+    else
+    {
+      RUNTIME_ERROR(std::string(boost::locale::translate("MAPPED SQL WRITER: Invalid column name: ")) + columnName,
+                    E_SQLWRITER_INVALIDCOLUMNNAME, LIBRARYNAME);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Resolves the select columns that could not be resolved when they were added, as the tables were not yet known.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::resolveSelectColumns()
+  {
+    if (selectColumnRefs.size() == selectFields.size())
+    {
+      for (std::size_t index = 0; index < selectFields.size(); index++)
+      {
+        if (!selectColumnRefs[index] && (selectFields[index].str().find_first_of("*(") == std::string::npos))
+        {
+          std::optional<SColumnRef> ref = resolveColumn(selectFields[index].str());
+
+          if (ref)
+          {
+            selectColumnRefs.mutate()[index] = ref;
+          };
+        };
+      };
+    };
+  }
+
+  /// @brief      Resolves a table name against the database map.
+  /// @param[in]  tableName: The table name.
+  /// @returns    The table ID.
+  /// @throws     GCL::runtime_error - The table is not in the database map.
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::optional<sqlWriter::CDatabaseMap::tableID_t> sqlWriter::resolveTable(std::string const &tableName) const
+  {
+    std::optional<CDatabaseMap::tableID_t> returnValue = databaseMap_->findTable(tableName);
+
+    if (!returnValue)
+    {
+      RUNTIME_ERROR(std::string(boost::locale::translate("MAPPED SQL WRITER: Invalid table name: ")) + tableName,
+                    E_SQLWRITER_INVALIDTABLENAME, LIBRARYNAME);
+    };
+
+    return returnValue;
   }
 
   /// @brief      Set the query type to a 'SELECT' query.
@@ -1249,6 +4337,7 @@ namespace GCL
 
     for (auto elem : fields)
     {
+      addColumnRef(selectColumnRefs, elem);
       selectFields.push_back(elem);
     };
 
@@ -1268,7 +4357,10 @@ namespace GCL
 
     for (auto elem : fields)
     {
-      selectFields.push_back(tableName + "." + elem);
+      std::string columnName = tableName + "." + elem;
+
+      addColumnRef(selectColumnRefs, columnName);
+      selectFields.push_back(std::move(columnName));
     };
 
     return *this;
@@ -1283,6 +4375,7 @@ namespace GCL
 
   sqlWriter &sqlWriter::set(std::string const &columnName, parameter const &value)
   {
+    addColumnRef(setColumnRefs, columnName);
     setFields.emplace_back(columnName, value);
 
     return (*this);
@@ -1298,15 +4391,29 @@ namespace GCL
   {
     for (auto elem : fields)
     {
+      addColumnRef(setColumnRefs, elem.first);
       setFields.push_back(elem);
     };
 
     return *this;
   }
 
+  /// @brief      Adds a SUM() function to the query.
+  /// @param[in]  column: The name of the column to sum.
+  /// @param[in]  as: The column name to assign to the SUM() function.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::sum(std::string const &column, std::string const &as)
+  {
+    return aggregate(AGG_SUM, column, as);
+  }
+
   /// @brief Converts the query into an SQL query string.
   /// @returns The SQL query as a string.
   /// @throws None.
+  /// @version 2026-10-18/GGB - Moved rendering to createQuery(). Use the query cache if one is attached.
   /// @version 2019-12-08/GGB - Added UPSERT query.
   /// @version 2017-08-12/GGB - Function created.
 
@@ -1314,49 +4421,116 @@ namespace GCL
   {
     std::string returnValue;
 
-    switch (queryType)
+    if (queryCache_)
     {
-      case qt_select:
-      {
-        returnValue = createSelectQuery();
-        break;
-      };
-      case qt_insert:
-      {
-        returnValue = createInsertQuery();
-        break;
-      };
-      case qt_update:
+      fingerprint_t fp = fingerprint();
+      std::optional<std::string> cachedValue = queryCache_->find(fp);
+
+      if (cachedValue)
       {
-        returnValue = createUpdateQuery();
-        break;
+        returnValue = std::move(*cachedValue);
       }
-      case qt_delete:
+      else
       {
-        returnValue = createDeleteQuery();
-        break;
-      }
-      case qt_upsert:
+        returnValue = createQuery();
+        queryCache_->insert(fp, returnValue);
+      };
+    }
+    else
+    {
+      returnValue = createQuery();
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Converts the query to one or more strings. Batched update queries are split so that each statement is no longer
+  ///             than maxLength. All other queries are returned as a single string.
+  /// @param[in]  maxLength: The maximum length of a statement. A single row that exceeds this is rendered in its own statement.
+  /// @returns    The SQL statements.
+  /// @throws     GCL::CCodeError
+  /// @throws     std::bad_alloc
+  /// @note       For the CASE form the number of rows in a statement is also limited by the IN list limit. (See setInListLimit())
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::vector<std::string> sqlWriter::strings(std::size_t maxLength) const
+  {
+    std::vector<std::string> returnValue;
+
+    if (queryType != qt_updateBatch)
+    {
+      returnValue.emplace_back(string());
+    }
+    else
+    {
+      std::vector<std::vector<std::string>> batchValues = createBatchValues();
+      std::optional<std::size_t> maxRows = inListLimit;
+      std::size_t baseLength = createUpdateBatchQuery(batchValues, 0, 0).size();
+      std::size_t first = 0;
+      std::size_t length = baseLength;
+
+      if (!maxRows && (dialect == ORACLE))
       {
-        returnValue = createUpsertQuery();
-        break;
-      }
-      default:
+        maxRows = 1000;
+      };
+
+      for (std::size_t row = 0; row < batchValues.size(); row++)
       {
-        CODE_ERROR;
-        break;
+        std::size_t rowLength = 0;
+
+          // Length added by the row. The separators are counted for every row, so this may over estimate by a few characters.
+
+        if (dialect == POSTGRE)
+        {
+          for (auto const &element : batchValues[row])
+          {
+            rowLength += element.size() + 2;
+          };
+          rowLength += 2;
+        }
+        else
+        {
+          for (std::size_t index = 1; index < batchValues[row].size(); index++)
+          {
+            rowLength += 12 + batchValues[row][0].size() + batchValues[row][index].size();   // " WHEN " k " THEN " v
+          };
+          rowLength += batchValues[row][0].size() + 2;
+        };
+
+        if ( (row != first) && ((length + rowLength > maxLength) || (maxRows && (row - first >= *maxRows))) )
+        {
+          returnValue.emplace_back(createUpdateBatchQuery(batchValues, first, row));
+          first = row;
+          length = baseLength;
+        };
+        length += rowLength;
       };
-    }
+      returnValue.emplace_back(createUpdateBatchQuery(batchValues, first, batchValues.size()));
+    };
 
     return returnValue;
   }
 
-  /// @brief
-  /// @todo Implement the getTableMap function. (Bug# 0000194)
+  /// @brief      Searches the databaseMap and determines the mapped table name.
+  /// @param[in]  search: The table name to map.
+  /// @returns    The mapped table name. If the table is not recognised in the databaseMap, the table name is returned unchanged.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Quote the name if quoting is enabled.
+  /// @version    2026-10-18/GGB - Implemented using the hashed database map. (Bug# 0000194)
 
   std::string sqlWriter::getTableMap(std::string const &search) const
   {
-    std::string returnValue = search;
+    std::string returnValue;
+    std::optional<CDatabaseMap::tableID_t> tableID = databaseMap_->findTable(search);
+
+    if (tableID)
+    {
+      returnValue = quoteName(databaseMap_->mappedTableName(*tableID));
+    }
+    else
+    {
+      returnValue = quoteName(search);
+    };
 
     return returnValue;
   }
@@ -1377,7 +4551,52 @@ namespace GCL
 
     queryType = qt_update;
 
+    if (validateNames_)
+    {
+      resolveTable(tableName);
+    };
+
+    updateTable = tableName;
+
+    return (*this);
+  }
+
+  /// @brief      Starts a batched update query. The rows are added with values(), each row being the key value followed by a value
+  ///             for each column.
+  /// @param[in]  tableName: The table to update.
+  /// @param[in]  keyName: The key column that identifies the rows.
+  /// @param[in]  columns: The columns to update.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @details    @code updateBatch("tbl_prices", "ID", {"Price"}).values({{1, 10.5}, {2, 11}}) @endcode translates to
+  ///             @code UPDATE tbl_prices SET Price = CASE ID WHEN 1 THEN 10.5 WHEN 2 THEN 11 ELSE Price END WHERE ID IN (1, 2)
+  ///             @endcode
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::updateBatch(std::string const &tableName, std::string const &keyName,
+                                    std::initializer_list<std::string> columns)
+  {
+    if (queryType != qt_none)
+    {
+      resetQuery();
+    };
+
+    queryType = qt_updateBatch;
+
+    if (validateNames_)
+    {
+      resolveTable(tableName);
+      resolveColumn(keyName);
+    };
+
     updateTable = tableName;
+    batchKey = keyName;
+
+    for (auto const &element : columns)
+    {
+      addColumnRef(selectColumnRefs, element);
+      selectFields.push_back(element);
+    };
 
     return (*this);
   }
@@ -1401,6 +4620,11 @@ namespace GCL
 
     queryType = qt_upsert;
 
+    if (validateNames_)
+    {
+      resolveTable(tableName);
+    };
+
     insertTable = tableName;
 
     return (*this);
@@ -1422,6 +4646,38 @@ namespace GCL
     return *this;
   }
 
+  /// @brief      Converts a parameter value to the string to insert into the query. Strings are quoted and bind values are
+  ///             prefixed with ':' if they are not already named (:) or positional (?).
+  /// @param[in]  value: The value to convert.
+  /// @returns    The string representation.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string sqlWriter::valueString(parameter const &value) const
+  {
+    std::string returnValue;
+
+    if (value.type() == typeid(std::string))
+    {
+      returnValue = "'" + value.to_string() + "'";
+    }
+    else if (value.type() == typeid(bindValue))
+    {
+      returnValue = value.to_string();
+
+      if (returnValue.empty() || ((returnValue.front() != ':') && (returnValue.front() != '?')))
+      {
+        returnValue.insert(0, 1, ':');
+      };
+    }
+    else
+    {
+      returnValue = value.to_string();
+    };
+
+    return returnValue;
+  }
+
   /// @brief Verifies if a string constitutes a valid SQL operator.
   /// @param[in] oper: The string to test.
   /// @returns true - The string is a valid operator.
@@ -1450,12 +4706,470 @@ namespace GCL
   {
     for (auto elem : fields)
     {
+      addColumnRef(whereColumnRefs, std::get<0>(elem));
       whereFields.push_back(elem);
     };
 
     return (*this);
   }
 
+  /// @brief      Adds a predicate expression to the where clause. Multiple predicates (and where fields) are joined with AND.
+  /// @param[in]  pred: The predicate to add.
+  /// @returns    (*this)
+  /// @throws     GCL::CRuntimeAssert
+  /// @details    @code where(predicateOr({predicateIn("ID", {1, 2, 3}), predicateIsNull("Parent")})) @endcode translates to
+  ///             @code WHERE ((ID IN (1, 2, 3)) OR (Parent IS NULL)) @endcode
+  /// @version    2026-10-18/GGB - Handles from other writers are rejected.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::where(predicate_t pred)
+  {
+    checkPredicate(pred);
+
+    wherePredicates.push_back(pred);
+
+    return (*this);
+  }
+
+  /// @brief      Adds a ranking or value window function to the select clause.
+  ///             @c window(WIN_ROW_NUMBER, "", {"customer"}, {{"orderDate", DESC}}, "rn")
+  /// @param[in]  function: The window function.
+  /// @param[in]  column: The column for LAG, LEAD, FIRST_VALUE and LAST_VALUE. (Ignored for the ranking functions)
+  /// @param[in]  partitionBy: The columns for the PARTITION BY clause. (May be empty)
+  /// @param[in]  orderBy: The columns for the ORDER BY clause of the window. (May be empty)
+  /// @param[in]  as: The alias for the function. (Optional)
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::window(EWindowFunction function, std::string const &column, std::initializer_list<std::string> partitionBy,
+                               std::initializer_list<orderBy_t> orderBy, std::string const &as)
+  {
+    windowFields.push_back(SWindowFunction{function, AGG_COUNT, column, partitionBy, orderBy, as});
+
+    return (*this);
+  }
+
+  /// @brief      Adds an aggregate function over a window to the select clause.
+  ///             @c window(AGG_SUM, "amount", {"customer"}, {{"orderDate", ASC}}, "runningTotal")
+  /// @param[in]  function: The aggregate function.
+  /// @param[in]  column: The column to aggregate.
+  /// @param[in]  partitionBy: The columns for the PARTITION BY clause. (May be empty)
+  /// @param[in]  orderBy: The columns for the ORDER BY clause of the window. (May be empty)
+  /// @param[in]  as: The alias for the function. (Optional)
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::window(EAggregate function, std::string const &column, std::initializer_list<std::string> partitionBy,
+                               std::initializer_list<orderBy_t> orderBy, std::string const &as)
+  {
+    windowFields.push_back(SWindowFunction{WIN_AGGREGATE, function, column, partitionBy, orderBy, as});
+
+    return (*this);
+  }
+
+  /// @brief      Adds a common table expression to the query. @c with("recent", subQuery)
+  /// @param[in]  name: The name of the expression.
+  /// @param[in]  query: The query. This is rendered when the expression is added.
+  /// @param[in]  columns: The column names of the expression. (Optional)
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::with(std::string const &name, sqlWriter const &query, std::initializer_list<std::string> columns)
+  {
+    commonTables.push_back(SCommonTable{name, columns, query.string(), false});
+
+    return (*this);
+  }
+
+  /// @brief      Adds a recursive common table expression to the query. The expression is the anchor query and the recursive
+  ///             query joined with UNION ALL.
+  /// @param[in]  name: The name of the expression.
+  /// @param[in]  anchor: The anchor (non-recursive) query.
+  /// @param[in]  recursive: The recursive query. This refers to the expression by name.
+  /// @param[in]  columns: The column names of the expression. (Required by ORACLE)
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter &sqlWriter::withRecursive(std::string const &name, sqlWriter const &anchor, sqlWriter const &recursive,
+                                      std::initializer_list<std::string> columns)
+  {
+    commonTables.push_back(SCommonTable{name, columns, anchor.string() + " UNION ALL " + recursive.string(), true});
+
+    return (*this);
+  }
+
+  //******************************************************************************************************************************
+  //
+  // Predicate expressions
+  //
+  //******************************************************************************************************************************
+
+  /// @brief      Checks that a handle refers to a predicate in the arena of this writer.
+  /// @param[in]  pred: The handle to check.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::checkPredicate(predicate_t pred) const
+  {
+    RUNTIME_ASSERT((pred.index < predicateArena.size()) && (predicateArena[pred.index].id == pred.id),
+                   boost::locale::translate("Invalid predicate."));
+  }
+
+  /// @brief      Stores a predicate in the arena and gives it a new ID.
+  /// @param[in]  pred: The predicate to store.
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Predicates are given an ID so that handles from other writers can be detected.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::addPredicate(SPredicate &&pred)
+  {
+    static std::atomic<std::uint64_t> predicateCounter{0};
+
+    if (validateNames_ && !pred.columnName.empty())
+    {
+      resolveColumn(pred.columnName);
+    };
+
+    pred.id = predicateCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+    predicateArena.push_back(std::move(pred));
+
+    return predicate_t{static_cast<std::uint32_t>(predicateArena.size() - 1), predicateArena.back().id};
+  }
+
+  /// @brief      Stores a group (AND/OR/NOT) predicate in the arena.
+  /// @param[in]  predicateType: The type of group.
+  /// @param[in]  children: The predicates in the group.
+  /// @returns    The handle of the predicate.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-18/GGB - All children are checked before any are stored.
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::addPredicateGroup(EPredicate predicateType, std::initializer_list<predicate_t> children)
+  {
+    SPredicate pred{predicateType, "", "", "", static_cast<std::uint32_t>(predicateChildren.size()),
+                    static_cast<std::uint32_t>(children.size())};
+
+    RUNTIME_ASSERT(children.size() != 0, boost::locale::translate("Empty predicate group."));
+
+    for (auto const &child : children)
+    {
+      checkPredicate(child);
+    };
+    for (auto const &child : children)
+    {
+      predicateChildren.push_back(child.index);
+    };
+
+    return addPredicate(std::move(pred));
+  }
+
+  /// @brief      Creates a predicate that is true if all the child predicates are true.
+  /// @param[in]  children: The child predicates.
+  /// @returns    The handle of the predicate.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateAnd(std::initializer_list<predicate_t> children)
+  {
+    return addPredicateGroup(pt_and, children);
+  }
+
+  /// @brief      Creates a BETWEEN predicate.
+  /// @param[in]  columnName: The column to test.
+  /// @param[in]  lower: The lower bound (inclusive)
+  /// @param[in]  upper: The upper bound (inclusive)
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateBetween(std::string const &columnName, parameter const &lower,
+                                                     parameter const &upper)
+  {
+    SPredicate pred{pt_between, columnName, "", "", static_cast<std::uint32_t>(predicateValues.size()), 2};
+
+    predicateValues.push_back(lower);
+    predicateValues.push_back(upper);
+
+    return addPredicate(std::move(pred));
+  }
+
+  /// @brief      Creates a comparison predicate.
+  /// @param[in]  columnName: The column to compare.
+  /// @param[in]  operatorString: The comparison operator.
+  /// @param[in]  value: The value to compare against.
+  /// @returns    The handle of the predicate.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateCompare(std::string const &columnName, std::string const &operatorString,
+                                                     parameter const &value)
+  {
+    RUNTIME_ASSERT(verifyOperator(operatorString), boost::locale::translate("Invalid operator."));
+
+    SPredicate pred{pt_compare, columnName, operatorString, "", static_cast<std::uint32_t>(predicateValues.size()), 1};
+
+    predicateValues.push_back(value);
+
+    return addPredicate(std::move(pred));
+  }
+
+  /// @brief      Creates an EXISTS (subquery) predicate.
+  /// @param[in]  subQuery: The subquery. This is rendered when the predicate is created.
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateExists(sqlWriter const &subQuery)
+  {
+    return addPredicate(SPredicate{pt_exists, "", "", subQuery.string(), 0, 0});
+  }
+
+  /// @brief      Creates an IN (values) predicate.
+  /// @param[in]  columnName: The column to test.
+  /// @param[in]  values: The list of values.
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @note       Long lists are split into chunks when rendered. (See setInListLimit())
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateIn(std::string const &columnName, parameterStorage values)
+  {
+    SPredicate pred{pt_in, columnName, "", "", static_cast<std::uint32_t>(predicateValues.size()),
+                    static_cast<std::uint32_t>(values.size())};
+
+    predicateValues.mutate().insert(predicateValues.end(), std::make_move_iterator(values.begin()),
+                                    std::make_move_iterator(values.end()));
+
+    return addPredicate(std::move(pred));
+  }
+
+  /// @brief      Creates an IN (subquery) predicate.
+  /// @param[in]  columnName: The column to test.
+  /// @param[in]  subQuery: The subquery. This is rendered when the predicate is created.
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateIn(std::string const &columnName, sqlWriter const &subQuery)
+  {
+    return addPredicate(SPredicate{pt_inQuery, columnName, "", subQuery.string(), 0, 0});
+  }
+
+  /// @brief      Creates an IS NOT NULL predicate.
+  /// @param[in]  columnName: The column to test.
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateIsNotNull(std::string const &columnName)
+  {
+    return addPredicate(SPredicate{pt_isNotNull, columnName, "", "", 0, 0});
+  }
+
+  /// @brief      Creates an IS NULL predicate.
+  /// @param[in]  columnName: The column to test.
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateIsNull(std::string const &columnName)
+  {
+    return addPredicate(SPredicate{pt_isNull, columnName, "", "", 0, 0});
+  }
+
+  /// @brief      Creates a predicate that negates another predicate.
+  /// @param[in]  child: The predicate to negate.
+  /// @returns    The handle of the predicate.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateNot(predicate_t child)
+  {
+    return addPredicateGroup(pt_not, {child});
+  }
+
+  /// @brief      Creates a NOT IN (values) predicate.
+  /// @param[in]  columnName: The column to test.
+  /// @param[in]  values: The list of values.
+  /// @returns    The handle of the predicate.
+  /// @throws     std::bad_alloc
+  /// @note       Long lists are split into chunks when rendered. (See setInListLimit())
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateNotIn(std::string const &columnName, parameterStorage values)
+  {
+    predicate_t returnValue = predicateIn(columnName, std::move(values));
+
+    predicateArena.mutate()[returnValue.index].predicateType = pt_notIn;
+
+    return returnValue;
+  }
+
+  /// @brief      Creates a predicate that is true if any of the child predicates are true.
+  /// @param[in]  children: The child predicates.
+  /// @returns    The handle of the predicate.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-18/GGB - Function created.
+
+  sqlWriter::predicate_t sqlWriter::predicateOr(std::initializer_list<predicate_t> children)
+  {
+    return addPredicateGroup(pt_or, children);
+  }
+
+  /// @brief      Renders an IN or NOT IN list. Lists longer than the IN list limit are split into chunks joined with OR (IN) or
+  ///             AND (NOT IN). ORACLE limits lists to 1000 values, so this limit is used for ORACLE if no limit is set.
+  /// @param[in]  out: The string to append to.
+  /// @param[in]  pred: The predicate to render.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::createInList(std::string &out, SPredicate const &pred) const
+  {
+    bool notIn = (pred.predicateType == pt_notIn);
+
+    if (pred.count == 0)
+    {
+      out += notIn ? "(1 = 1)" : "(1 = 0)";     // An empty IN list is not valid SQL.
+    }
+    else
+    {
+      std::size_t chunkSize = inListLimit ? *inListLimit : ((dialect == ORACLE) ? 1000 : pred.count);
+      std::string columnName = getColumnMap(pred.columnName);
+      std::string keyword = notIn ? " NOT IN (" : " IN (";
+      std::string joiner = notIn ? " AND " : " OR ";
+      bool chunked = (chunkSize != 0) && (pred.count > chunkSize);
+
+      if (chunkSize == 0)
+      {
+        chunkSize = pred.count;
+      };
+
+      out.reserve(out.size() + pred.count * 8 + (pred.count / chunkSize + 1) * (columnName.size() + 16));
+
+      if (chunked)
+      {
+        out += "(";
+      };
+
+      for (std::uint32_t index = 0; index < pred.count; index++)
+      {
+        if ((index % chunkSize) == 0)
+        {
+          if (index != 0)
+          {
+            out += "))";
+            out += joiner;
+          };
+          out += "(";
+          out += columnName;
+          out += keyword;
+        }
+        else
+        {
+          out += ", ";
+        };
+        out += valueString(predicateValues[pred.first + index]);
+      };
+
+      out += "))";
+
+      if (chunked)
+      {
+        out += ")";
+      };
+    };
+  }
+
+  /// @brief      Renders a predicate (and all child predicates) into the output string.
+  /// @param[in]  out: The string to append to.
+  /// @param[in]  pred: The predicate to render.
+  /// @throws     std::bad_alloc
+  /// @throws     GCL::CCodeError
+  /// @version    2026-10-18/GGB - Function created.
+
+  void sqlWriter::createPredicate(std::string &out, predicate_t pred) const
+  {
+    SPredicate const &element = predicateArena[pred.index];
+
+    switch (element.predicateType)
+    {
+      case pt_compare:
+      {
+        out += "(" + getColumnMap(element.columnName) + " " + element.operatorString + " ";
+        out += valueString(predicateValues[element.first]);
+        out += ")";
+        break;
+      }
+      case pt_and:
+      case pt_or:
+      {
+        out += "(";
+        for (std::uint32_t index = 0; index < element.count; index++)
+        {
+          if (index != 0)
+          {
+            out += (element.predicateType == pt_and) ? " AND " : " OR ";
+          };
+          createPredicate(out, predicate_t{predicateChildren[element.first + index]});
+        };
+        out += ")";
+        break;
+      }
+      case pt_not:
+      {
+        out += "(NOT ";
+        createPredicate(out, predicate_t{predicateChildren[element.first]});
+        out += ")";
+        break;
+      }
+      case pt_in:
+      case pt_notIn:
+      {
+        createInList(out, element);
+        break;
+      }
+      case pt_between:
+      {
+        out += "(" + getColumnMap(element.columnName) + " BETWEEN ";
+        out += valueString(predicateValues[element.first]);
+        out += " AND ";
+        out += valueString(predicateValues[element.first + 1]);
+        out += ")";
+        break;
+      }
+      case pt_isNull:
+      {
+        out += "(" + getColumnMap(element.columnName) + " IS NULL)";
+        break;
+      }
+      case pt_isNotNull:
+      {
+        out += "(" + getColumnMap(element.columnName) + " IS NOT NULL)";
+        break;
+      }
+      case pt_exists:
+      {
+        out += "(EXISTS (" + element.subQuery + "))";
+        break;
+      }
+      case pt_inQuery:
+      {
+        out += "(" + getColumnMap(element.columnName) + " IN (" + element.subQuery + "))";
+        break;
+      }
+      default:
+      {
+        CODE_ERROR;
+        break;
+      }
+    };
+  }
+
   /// @brief      to_string function for a bind value.
   /// @param[in]  bv: The value to convert to a std::string.
   /// @version    2020-09-24/GGB - Function created.
@@ -1465,5 +5179,15 @@ namespace GCL
     return bv.to_string();
   }
 
+  /// @brief      Converts a null value to a string.
+  /// @param[in]  nv: The null value.
+  /// @returns    "NULL"
+  /// @version    2026-10-18/GGB - Function created.
+
+  std::string to_string(GCL::sqlWriter::nullValue const &nv)
+  {
+    return nv.to_string();
+  }
+
 }  // namespace GCL
 
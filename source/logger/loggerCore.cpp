@@ -28,7 +28,8 @@
 //
 // CLASSES INCLUDED:    CLogger
 //
-// HISTORY:             2018-08-12 GGB - gnuCash-pud debugging and release.
+// HISTORY:             2026-10-18 GGB - The writer thread stops when the logger is destroyed with an empty queue.
+//                      2018-08-12 GGB - gnuCash-pud debugging and release.
 //                      2015-09-22 GGB - AIRDAS 2015.09 release
 //                      2014-07-20 GGB - Development of class for "Observatory Weather System - Service"
 //
@@ -290,6 +291,7 @@ namespace GCL
     /// @brief Destructor for the class.
     /// @throws None.
     /// @details Needs too finish the thread and destroy the thread object.
+    /// @version 2026-10-18/GGB - Wake the writer thread while it is waiting on an empty queue.
     /// @version 2019-10-22/GGB - 1. Changed writerThread to a std::unique_ptr
     ///                           2. Changed writerThread from a boost::thread to a std::thread
     /// @version 2014-12-24/GGB - Function created.
@@ -304,6 +306,9 @@ namespace GCL
           UniqueLock lock(terminateMutex);
           terminateThread = true;
         }
+        {
+          UniqueLock lock(queueMutex);    // Ensures the writer is waiting, or has not yet checked terminateThread.
+        }
         cvQueueData.notify_one();
 
         writerThread->join();
@@ -400,6 +405,7 @@ namespace GCL
 
     /// @brief Shuts down the writer thread.
     /// @throws None.
+    /// @version 2026-10-18/GGB - Wake the writer thread while it is waiting on an empty queue.
     /// @version 2019-10-22/GGB - 1. Changed writerThread to a std::unique_ptr
     ///                           2. Changed writerThread from a boost::thread to a std::thread
     /// @version 2015-09-19/GGB - Added locking to the sink container.
@@ -413,6 +419,9 @@ namespace GCL
         UniqueLock writeLock(terminateMutex);
         terminateThread = true;
       };  // Lock released at this point.
+      {
+        UniqueLock lock(queueMutex);    // Ensures the writer is waiting, or has not yet checked terminateThread.
+      };
       cvQueueData.notify_one();   // Notify the queue to run.
 
       writerThread->join();
@@ -449,6 +458,7 @@ namespace GCL
     /// @brief This is the threaded function that executes concurrently.
     /// @details Whenever a message is added to the queue, this is the function that writes it to the stream.
     /// @throws None.
+    /// @version 2026-10-18/GGB - Stop waiting when termination is requested. The thread never stopped if the queue was empty.
     /// @version 2016-05-07/GGB - Updated locking strategy to remove a number of errors.
     /// @version 2015-09-19/GGB - Added locking to the sink container.
     /// @version 2014-12-24/GGB - Updated to write to multiple streams.
@@ -466,6 +476,13 @@ namespace GCL
           SharedLock readLock(queueMutex);
           while (messageQueue.empty())
           {
+            {
+              SharedLock lock(terminateMutex);
+              if (terminateThread)
+              {
+                break;
+              };
+            };
             cvQueueData.wait(readLock);             // Wait for notify from adding data. NB. This also unlocks the mutex!
           };
         };    // The shared lock is released on exit from the code block.
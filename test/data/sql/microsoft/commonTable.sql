@@ -0,0 +1 @@
+WITH recent AS (SELECT customer, amount FROM orders WHERE (orderDate > '2026-01-01')) SELECT customer, SUM(amount) AS total FROM recent GROUP BY customer
@@ -0,0 +1 @@
+INSERT INTO tbl_users(ID, Name) VALUES (1, 'Alice'), (2, 'Bob')
@@ -0,0 +1 @@
+WITH tree (ID, Parent) AS (SELECT ID, Parent FROM nodes WHERE (ID = 1) UNION ALL SELECT nodes.ID, nodes.Parent FROM nodes INNER JOIN tree ON nodes.Parent=tree.ID) SELECT ID FROM tree
@@ -0,0 +1 @@
+SELECT ID, Name FROM tbl_users WHERE (ID > 10) ORDER BY Name ASC OFFSET 10 ROWS FETCH NEXT 5 ROWS ONLY 
@@ -0,0 +1 @@
+SELECT DISTINCT TOP 5 Name FROM tbl_users ORDER BY Name ASC 
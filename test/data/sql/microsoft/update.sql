@@ -0,0 +1 @@
+UPDATE tbl_users SET Name = 'Carol' WHERE (ID = 3)
@@ -0,0 +1 @@
+UPDATE tbl_prices SET Price = CASE ID WHEN 1 THEN 10.5 WHEN 2 THEN 11 ELSE Price END, Name = CASE ID WHEN 1 THEN 'A' WHEN 2 THEN 'B' ELSE Name END WHERE ID IN (1, 2)
@@ -0,0 +1 @@
+MERGE INTO tbl_users AS target USING (SELECT 5 AS ID, 'Dave' AS Name) AS source ON (target.ID = source.ID) WHEN MATCHED THEN UPDATE SET target.Name = source.Name WHEN NOT MATCHED THEN INSERT (ID, Name) VALUES (source.ID, source.Name);
@@ -0,0 +1 @@
+SELECT region, product, SUM(amount) AS total FROM sales GROUP BY region, product WITH ROLLUP
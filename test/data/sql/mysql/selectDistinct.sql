@@ -0,0 +1 @@
+SELECT DISTINCT Name FROM tbl_users ORDER BY Name ASC LIMIT 5 
@@ -0,0 +1 @@
+SELECT DISTINCT Name FROM tbl_users ORDER BY Name ASC FETCH NEXT 5 ROWS ONLY 
@@ -0,0 +1 @@
+DELETE FROM tbl_users WHERE (ID = 4)
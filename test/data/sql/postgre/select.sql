@@ -0,0 +1 @@
+SELECT ID, Name FROM tbl_users WHERE (ID > 10) ORDER BY Name ASC LIMIT 5 OFFSET 10 
@@ -0,0 +1 @@
+UPDATE tbl_prices SET Price = v.Price, Name = v.Name FROM (VALUES (1, 10.5, 'A'), (2, 11, 'B')) AS v(ID, Price, Name) WHERE tbl_prices.ID = v.ID
@@ -0,0 +1 @@
+INSERT INTO tbl_users(ID, Name) VALUES (5, 'Dave') ON CONFLICT (ID) DO UPDATE SET Name = EXCLUDED.Name
@@ -0,0 +1 @@
+SELECT customer, amount, ROW_NUMBER() OVER (PARTITION BY customer ORDER BY orderDate DESC) AS rn, LAG(amount) OVER (PARTITION BY customer ORDER BY orderDate ASC) AS previous, SUM(amount) OVER (PARTITION BY customer) AS total FROM orders
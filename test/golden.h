@@ -0,0 +1,92 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								golden
+// SUBSYSTEM:						Unit tests
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Comparison of output against golden files held below GCL_TEST_DATA.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_TEST_GOLDEN_H
+#define GCL_TEST_GOLDEN_H
+
+  // Standard C++ library header files
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+  // Miscellaneous library header files
+
+#include <boost/test/unit_test.hpp>
+
+#ifndef GCL_TEST_DATA
+#define GCL_TEST_DATA "data"
+#endif
+
+namespace GCL::test
+{
+  /// @brief      Returns the full path of a file in the test data directory.
+  /// @param[in]  fileName: The name of the file relative to the data directory.
+  /// @returns    The path of the file.
+  /// @version    2026-10-18/GGB - Function created.
+
+  inline std::string dataFile(std::string const &fileName)
+  {
+    return std::string(GCL_TEST_DATA) + "/" + fileName;
+  }
+
+  /// @brief      Compares the text with the golden file. If GCL_UPDATE_GOLDEN is set the golden file is rewritten instead.
+  /// @param[in]  fileName: The name of the golden file relative to the data directory.
+  /// @param[in]  text: The text to compare.
+  /// @version    2026-10-18/GGB - Function created.
+
+  inline void checkGolden(std::string const &fileName, std::string const &text)
+  {
+    std::string path = dataFile(fileName);
+
+    if (std::getenv("GCL_UPDATE_GOLDEN") != nullptr)
+    {
+      std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+      ofs << text << "\n";
+    }
+    else
+    {
+      std::ifstream ifs(path, std::ios::binary);
+      BOOST_REQUIRE_MESSAGE(ifs, "Missing golden file " + path);
+
+      std::string golden{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+      if (!golden.empty() && golden.back() == '\n')
+      {
+        golden.pop_back();
+      };
+
+      BOOST_TEST(text == golden, fileName << ":\n  got:      " << text << "\n  expected: " << golden);
+    };
+  }
+}
+
+#endif // GCL_TEST_GOLDEN_H
@@ -0,0 +1,781 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								testConfigurationReader
+// SUBSYSTEM:						Unit tests
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Behaviour tests for the configuration readers. Each test writes its files to a temporary directory.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#include "include/configurationReader/readerSchema.hpp"
+#include "include/configurationReader/readerSections.hpp"
+#include "include/configurationReader/readerVanilla.hpp"
+
+  // Standard C++ library header files
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+  // Miscellaneous library header files
+
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+
+namespace
+{
+  /// @brief  Fixture creating an empty temporary directory that is removed after the test.
+
+  struct CTemporaryDirectory
+  {
+    std::filesystem::path directory;
+
+    CTemporaryDirectory()
+    {
+      static std::atomic<int> counter{0};
+
+      directory = std::filesystem::temp_directory_path() /
+                  ("GCLTest-" + std::to_string(::getpid()) + "-" + std::to_string(counter++));
+      std::filesystem::create_directories(directory);
+    }
+
+    ~CTemporaryDirectory()
+    {
+      std::error_code ec;
+      std::filesystem::remove_all(directory, ec);
+    }
+
+    /// @brief      Writes a file in the temporary directory.
+    /// @param[in]  fileName: The name of the file.
+    /// @param[in]  text: The contents of the file.
+    /// @returns    The path of the file.
+
+    std::string write(std::string const &fileName, std::string const &text)
+    {
+      std::filesystem::path path = directory / fileName;
+
+      std::filesystem::create_directories(path.parent_path());
+      std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+
+      return path.string();
+    }
+  };
+
+  /// @brief  Structure loaded by the schema tests.
+
+  struct SServerConfig
+  {
+    std::string host;
+    std::uint16_t port = 0;
+    std::chrono::milliseconds timeout{0};
+    std::uint64_t bufferSize = 0;
+    bool verbose = false;
+    double ratio = 0;
+    std::vector<std::string> peers;
+    std::optional<std::string> logFile;
+  };
+
+  auto const serverSchema = GCL::configurationSchema<SServerConfig>(
+    GCL::schemaField("server/host", &SServerConfig::host).defaultValue("localhost"),
+    GCL::schemaField("server/port", &SServerConfig::port).range(1, 65000),
+    GCL::schemaField("server/timeout", &SServerConfig::timeout).defaultValue(std::chrono::seconds(5)),
+    GCL::schemaField("server/buffer", &SServerConfig::bufferSize).byteSize().defaultValue(4096),
+    GCL::schemaField("server/verbose", &SServerConfig::verbose).defaultValue(false),
+    GCL::schemaField("server/ratio", &SServerConfig::ratio).range(0.0, 1.0).defaultValue(0.5),
+    GCL::schemaField("server/peers", &SServerConfig::peers).seperator(';').defaultValue({}),
+    GCL::schemaField("server/logfile", &SServerConfig::logFile));
+
+  /// @brief  Reader giving the tests access to the snapshots.
+
+  class CSnapshotReader : public GCL::CReaderSections
+  {
+  public:
+    using CReaderSections::CReaderSections;
+    using CReaderSections::sharedSnapshot;
+  };
+}
+
+BOOST_FIXTURE_TEST_SUITE(configurationCache, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(cacheWrittenAndRead)
+{
+  std::string fileName = write("cache.ini", "[server]\nport = 8080\nhost = example\n");
+
+  {
+    GCL::CReaderSections reader(fileName, "=", "#", true, true);
+    BOOST_TEST(*reader.tagValueInt32("server", "port") == 8080);
+  }
+
+  BOOST_TEST(std::filesystem::exists(fileName + ".cache"));
+
+  GCL::CReaderSections reader(fileName, "=", "#", true, true);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 8080);
+  BOOST_TEST(*reader.tagValueString("server", "host") == "example");
+}
+
+BOOST_AUTO_TEST_CASE(cacheRejectedWhenContentChanges)
+{
+  std::string fileName = write("cache.ini", "[server]\nport = 1111\n");
+
+  {
+    GCL::CReaderSections reader(fileName, "=", "#", true, true);
+    BOOST_TEST(*reader.tagValueInt32("server", "port") == 1111);
+  }
+
+    // Same size and modification time, different contents.
+
+  auto writeTime = std::filesystem::last_write_time(fileName);
+  write("cache.ini", "[server]\nport = 2222\n");
+  std::filesystem::last_write_time(fileName, writeTime);
+
+  GCL::CReaderSections reader(fileName, "=", "#", true, true);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 2222);
+}
+
+BOOST_AUTO_TEST_CASE(cacheRejectedWhenMiddleChanges)
+{
+    // Over 8kB, with the changed value in the middle so that it is not in the first or last 4kB.
+
+  std::string padding = "[padding]\n";
+
+  for (int index = 0; index < 500; index++)
+  {
+    padding += "tag" + std::to_string(1000 + index) + " = value\n";
+  };
+
+  std::string fileName = write("cache.ini", padding + "[server]\nport = 1111\n" + padding);
+
+  BOOST_TEST(std::filesystem::file_size(fileName) > 8192);
+
+  {
+    GCL::CReaderSections reader(fileName, "=", "#", true, true);
+    BOOST_TEST(*reader.tagValueInt32("server", "port") == 1111);
+  }
+
+  auto writeTime = std::filesystem::last_write_time(fileName);
+  write("cache.ini", padding + "[server]\nport = 2222\n" + padding);
+  std::filesystem::last_write_time(fileName, writeTime);
+
+  GCL::CReaderSections reader(fileName, "=", "#", true, true);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 2222);
+}
+
+BOOST_AUTO_TEST_CASE(cacheRejectedWhenSettingsChange)
+{
+  std::string fileName = write("cache.ini", "[server]\nport = 80 ; comment\n");
+
+  {
+    GCL::CReaderSections reader(fileName, "=", "#", true, true);
+    BOOST_TEST(*reader.tagValueString("server", "port") == "80 ; comment");
+  }
+
+  GCL::CReaderSections reader(fileName, "=", ";", true, true);
+  BOOST_TEST(*reader.tagValueString("server", "port") == "80");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(configurationIncludes, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(laterDefinitionOverridesInclude)
+{
+  write("base.ini", "[server]\nport = 80\nhost = example\n");
+  std::string fileName = write("main.ini", "include base.ini\n[server]\nport = 8080\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 8080);
+  BOOST_TEST(*reader.tagValueString("server", "host") == "example");
+  BOOST_TEST(reader.tagLocation("server/port")->file == fileName);
+  BOOST_TEST(reader.tagLocation("server/port")->line == 3);
+}
+
+BOOST_AUTO_TEST_CASE(laterIncludeOverridesEarlierDefinition)
+{
+  std::string overrideName = write("override.ini", "[server]\nport = 9090\n");
+  std::string fileName = write("main.ini", "[server]\nport = 8080\ninclude override.ini\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 9090);
+  BOOST_TEST(reader.tagLocation("server/port")->file == overrideName);
+}
+
+BOOST_AUTO_TEST_CASE(includeDirectoryInFilenameOrder)
+{
+  write("conf.d/10-first.ini", "[server]\nport = 1\nhost = first\n");
+  write("conf.d/20-second.ini", "[server]\nport = 2\n");
+  std::string fileName = write("main.ini", "include_dir conf.d\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 2);
+  BOOST_TEST(*reader.tagValueString("server", "host") == "first");
+}
+
+BOOST_AUTO_TEST_CASE(sharedIncludeMergedOnce)
+{
+  write("common.ini", "[server]\nx = common\ny = common\n");
+  write("a.ini", "include common.ini\n[server]\nx = fromA\n");
+  write("b.ini", "include common.ini\n[server]\nz = fromB\n");
+  std::string fileName = write("main.ini", "include a.ini\ninclude b.ini\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueString("server", "x") == "fromA");
+  BOOST_TEST(*reader.tagValueString("server", "y") == "common");
+  BOOST_TEST(*reader.tagValueString("server", "z") == "fromB");
+}
+
+BOOST_AUTO_TEST_CASE(firstValueInFileKept)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 1\nport = 2\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 1);
+}
+
+BOOST_AUTO_TEST_CASE(layersOverrideIncludes)
+{
+  write("base.ini", "[server]\nport = 80\n");
+  std::string fileName = write("main.ini", "include base.ini\n[server]\nport = 8080\n");
+  char const *argv[] = {"program", "--server/port=7070"};
+
+  GCL::CReaderSections reader(fileName);
+  reader.setCommandLine(2, argv);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 7070);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(configurationReload, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(reloadPublishesNewValues)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 80\nhost = example\n");
+  std::vector<std::string> changes;
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 80);
+
+  reader.addChangeCallback("server", "", [&changes](std::string_view, std::string_view tagName, std::optional<std::string_view> value)
+  {
+    changes.push_back(std::string(tagName) + "=" + (value ? std::string(*value) : "<removed>"));
+  });
+
+  write("main.ini", "[server]\nport = 8080\n");
+  reader.reload();
+
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 8080);
+  BOOST_TEST(!reader.tagValueString("server", "host"));
+  BOOST_TEST(changes == (std::vector<std::string>{"port=8080", "host=<removed>"}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(oldSnapshotReleased)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 80\n");
+
+  CSnapshotReader reader(fileName);
+  std::weak_ptr<GCL::CKeyStore const> oldSnapshot = reader.sharedSnapshot();
+
+  reader.reload();
+  BOOST_TEST(oldSnapshot.expired());
+}
+
+BOOST_AUTO_TEST_CASE(heldSnapshotKeptAfterReload)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 80\n");
+
+  CSnapshotReader reader(fileName);
+  std::shared_ptr<GCL::CKeyStore const> oldSnapshot = reader.sharedSnapshot();
+
+  write("main.ini", "[server]\nport = 8080\n");
+  reader.reload();
+
+  BOOST_TEST(*oldSnapshot->find("server", "port") == "80");
+  BOOST_TEST(reader.tagValueView("server", "port")->value() == "8080");
+}
+
+BOOST_AUTO_TEST_CASE(viewValidAfterReload)
+{
+  std::string fileName = write("main.ini", "[server]\nhost = first.example\n");
+
+  GCL::CReaderSections reader(fileName);
+  std::optional<GCL::CReaderCore::CValueView> view = reader.tagValueView("server", "host");
+
+  write("main.ini", "[server]\nhost = second.example\n");
+  reader.reload();
+  reader.reload();
+
+  BOOST_TEST(view->value() == "first.example");
+  BOOST_TEST(reader.tagValueView("server", "host")->value() == "second.example");
+  BOOST_TEST(reader.tagLocation("server", "host")->file == fileName);
+}
+
+BOOST_AUTO_TEST_CASE(callbackMaySetLayers)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 80\n");
+
+  GCL::CReaderSections reader(fileName, "=", "#", true);
+  reader.addChangeCallback("server", "port", [&reader](std::string_view, std::string_view, std::optional<std::string_view>)
+  {
+    reader.setDefault("server/timeout", "5s");
+  });
+
+  write("main.ini", "[server]\nport = 8080\n");
+  reader.reload();
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 8080);
+}
+
+BOOST_AUTO_TEST_CASE(watchedFileReloaded)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 80\n");
+  std::atomic<int> changes{0};
+
+  auto waitFor = [&changes](int count)
+  {
+    for (int retry = 0; (retry < 500) && (changes < count); ++retry)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    };
+    return changes >= count;
+  };
+
+  {
+    GCL::CReaderSections reader(fileName);
+
+    reader.addChangeCallback("server", "port", [&changes](std::string_view, std::string_view, std::optional<std::string_view>)
+    {
+      ++changes;
+    });
+    reader.startWatching();
+    BOOST_TEST(reader.watching());
+
+      // Written in place.
+
+    write("main.ini", "[server]\nport = 8080\n");
+    BOOST_TEST(waitFor(1));
+    BOOST_TEST(*reader.tagValueInt32("server", "port") == 8080);
+
+      // Replaced by renaming another file over it.
+
+    std::string newName = write("main.ini.new", "[server]\nport = 9090\n");
+    std::filesystem::rename(newName, fileName);
+    BOOST_TEST(waitFor(2));
+    BOOST_TEST(*reader.tagValueInt32("server", "port") == 9090);
+
+    reader.stopWatching();
+    BOOST_TEST(!reader.watching());
+    reader.startWatching();
+  }
+
+    // The destructor stopped the watch thread. Later changes are not seen.
+
+  int const count = changes;
+
+  write("main.ini", "[server]\nport = 1\n");
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  BOOST_TEST(changes == count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+  // Lookups in several threads while the file is reloaded. Run under the thread sanitizer by 'make tsan'.
+
+BOOST_FIXTURE_TEST_SUITE(configurationConcurrency, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(lookupsDuringReloads)
+{
+  constexpr int sectionCount = 50;
+  constexpr int tagCount = 20;
+  constexpr int threadCount = 4;
+  constexpr int lookupCount = 5000;
+
+  auto fileText = [](bool extra)
+  {
+    std::string returnValue;
+
+    for (int section = 0; section < sectionCount; ++section)
+    {
+      returnValue += "[s" + std::to_string(section) + "]\n";
+
+      for (int tag = 0; tag < tagCount; ++tag)
+      {
+        returnValue += "t" + std::to_string(tag) + " = " + std::to_string(tag) + "\n";
+      };
+    };
+
+      // The extra section makes each reload change the values, so the change callbacks are called.
+
+    if (extra)
+    {
+      returnValue += "[extra]\nvalue = 1\n";
+    };
+
+    return returnValue;
+  };
+
+  std::string fileName = write("main.ini", fileText(false));
+  GCL::CReaderSections reader(fileName, "=", "#", true);
+  std::atomic<long> sum{0};
+  std::atomic<int> callbackCount{0};
+  std::vector<std::thread> threads;
+
+  reader.addChangeCallback("extra", "", [&callbackCount](std::string_view, std::string_view, std::optional<std::string_view>)
+  {
+    ++callbackCount;
+  });
+
+  for (int thread = 0; thread < threadCount; ++thread)
+  {
+    threads.emplace_back([&reader, &sum, thread]
+    {
+      long localSum = 0;
+
+      for (int lookup = 0; lookup < lookupCount; ++lookup)
+      {
+        std::string section = "s" + std::to_string((lookup + thread) % sectionCount);
+        std::string tag = "t" + std::to_string(lookup % tagCount);
+
+        localSum += *reader.tagValueInt32(section, tag);
+        localSum += static_cast<long>(*reader.tagValueDouble(section + "/" + tag));
+      };
+
+      sum += localSum;
+    });
+  };
+
+  for (int reload = 0; reload < 20; ++reload)
+  {
+    write("main.ini", fileText((reload % 2) == 0));
+    reader.reload();
+  };
+
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  };
+
+    // Each lookup adds the tag number twice.
+
+  BOOST_TEST(sum == 2L * threadCount * (lookupCount / tagCount) * (tagCount * (tagCount - 1) / 2));
+  BOOST_TEST(callbackCount == 20);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(configurationVanilla, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(vanillaValuesRead)
+{
+  std::string fileName = write("main.cfg", "# Comment line\nport = 8080 # trailing comment\nhost = example\nnot a value\n");
+
+  GCL::CReaderVanilla reader(fileName);
+  BOOST_TEST(*reader.tagValueInt32("port") == 8080);
+  BOOST_TEST(*reader.tagValueString("host") == "example");
+  BOOST_TEST(reader.tagValueView(" host ")->value() == "example");
+  BOOST_TEST(!reader.tagValueString("not a value"));
+  BOOST_TEST(!reader.tagValueString("missing"));
+}
+
+BOOST_AUTO_TEST_CASE(vanillaSameValuesAsSections)
+{
+  std::string vanillaName = write("main.cfg", "port = 8080\nratio = 0.5\n");
+  std::string sectionsName = write("main.ini", "port = 8080\nratio = 0.5\n");
+
+  GCL::CReaderVanilla vanilla(vanillaName);
+  GCL::CReaderSections sections(sectionsName);
+  BOOST_TEST(*vanilla.tagValueInt32("port") == *sections.tagValueInt32("", "port"));
+  BOOST_TEST(*vanilla.tagValueDouble("ratio") == *sections.tagValueDouble("", "ratio"));
+}
+
+BOOST_AUTO_TEST_CASE(vanillaReload)
+{
+  std::string fileName = write("main.cfg", "port = 80\n");
+
+  GCL::CReaderVanilla reader(fileName, "=", "#", true);
+  BOOST_TEST(*reader.tagValueInt32("port") == 80);
+
+  write("main.cfg", "port = 8080\n");
+  reader.reload();
+  BOOST_TEST(*reader.tagValueInt32("port") == 8080);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(configurationConversions, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(numbersConverted)
+{
+  std::string fileName = write("main.ini", "[values]\nratio = +0.25\nport = 65535\nbig = 65536\nnegative = -42\n"
+                                           "int64 = -9000000000\nuint64 = 18446744073709551615\ntext = 12abc\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueDouble("values", "ratio") == 0.25);
+  BOOST_TEST(*reader.tagValueUInt16("values", "port") == 65535);
+  BOOST_CHECK_THROW(reader.tagValueUInt16("values", "big"), std::runtime_error);
+  BOOST_TEST(*reader.tagValueInt32("values", "negative") == -42);
+  BOOST_TEST(*reader.tagValueInt64("values", "int64") == -9000000000LL);
+  BOOST_TEST(*reader.tagValueUInt64("values", "uint64") == 18446744073709551615ULL);
+  BOOST_CHECK_THROW(reader.tagValueInt32("values", "text"), std::runtime_error);
+  BOOST_CHECK_THROW(reader.tagValueDouble("values", "text"), std::runtime_error);
+  BOOST_TEST(!reader.tagValueInt32("values", "missing"));
+}
+
+BOOST_AUTO_TEST_CASE(boolsConverted)
+{
+  std::string fileName = write("main.ini", "[flags]\na = true\nb = No\nc = ON\nd = 0\ne = maybe\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueBool("flags", "a") == true);
+  BOOST_TEST(*reader.tagValueBool("flags", "b") == false);
+  BOOST_TEST(*reader.tagValueBool("flags", "c") == true);
+  BOOST_TEST(*reader.tagValueBool("flags", "d") == false);
+  BOOST_CHECK_THROW(reader.tagValueBool("flags", "e"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(durationsAndSizesConverted)
+{
+  using namespace std::chrono_literals;
+
+  std::string fileName = write("main.ini", "[limits]\ntimeout = 250ms\ninterval = 30\nexpiry = 2 h\nbad = 5 weeks\n"
+                                           "buffer = 64MB\npage = 4 k\nbytes = 100\ntooBig = 20000000TB\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST((*reader.tagValueDuration("limits", "timeout") == 250ms));
+  BOOST_TEST((*reader.tagValueDuration("limits", "interval") == 30s));
+  BOOST_TEST((*reader.tagValueDuration("limits", "expiry") == 2h));
+  BOOST_CHECK_THROW(reader.tagValueDuration("limits", "bad"), std::runtime_error);
+  BOOST_TEST(*reader.tagValueByteSize("limits", "buffer") == 64ULL * 1024 * 1024);
+  BOOST_TEST(*reader.tagValueByteSize("limits", "page") == 4096);
+  BOOST_TEST(*reader.tagValueByteSize("limits", "bytes") == 100);
+  BOOST_CHECK_THROW(reader.tagValueByteSize("limits", "tooBig"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(listsSplit)
+{
+  std::string fileName = write("main.ini", "[lists]\nhosts = a, b ,c\npath = /usr:/bin\nempty =\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_TEST(*reader.tagValueList("lists", "hosts") == (std::vector<std::string>{"a", "b", "c"}),
+             boost::test_tools::per_element());
+  BOOST_TEST(*reader.tagValueList("lists", "path", ':') == (std::vector<std::string>{"/usr", "/bin"}),
+             boost::test_tools::per_element());
+  BOOST_TEST(reader.tagValueList("lists", "empty")->empty());
+}
+
+BOOST_AUTO_TEST_CASE(cachedConversionsMatch)
+{
+  std::string fileName = write("main.ini", "[values]\nport = 8080\n");
+
+  GCL::CReaderSections reader(fileName);
+
+    // The first call converts and caches the value, the later calls use the cache.
+
+  for (int repeat = 0; repeat < 3; ++repeat)
+  {
+    BOOST_TEST(*reader.tagValueInt32("values", "port") == 8080);
+    BOOST_TEST(*reader.tagValueDouble("values", "port") == 8080.0);
+    BOOST_TEST(*reader.tagValueUInt16("values", "port") == 8080);
+  };
+}
+
+BOOST_AUTO_TEST_CASE(conversionErrorHasLocation)
+{
+  std::string fileName = write("main.ini", "[values]\n\nport = eighty\n");
+
+  GCL::CReaderSections reader(fileName);
+
+  try
+  {
+    reader.tagValueInt32("values", "port");
+    BOOST_FAIL("Conversion did not throw");
+  }
+  catch(std::runtime_error const &e)
+  {
+    BOOST_TEST(std::string(e.what()).find(fileName + ":3") != std::string::npos);
+  };
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(configurationLayers, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(defaultsBelowFile)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 8080\n");
+
+  GCL::CReaderSections reader(fileName);
+  reader.setDefault("server/port", "80");
+  reader.setDefault("server/timeout", "30s");
+  reader.setDefault("server/timeout", "60s");
+
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 8080);
+  BOOST_TEST(*reader.tagValueString("server", "timeout") == "60s");
+  BOOST_TEST(reader.tagLocation("server/timeout")->file == "<default>");
+}
+
+BOOST_AUTO_TEST_CASE(environmentAboveFile)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 8080\nhost = example\n");
+
+  ::setenv("GCLTEST_SERVER__PORT", "9090", 1);
+  ::setenv("GCLTEST_CACHE__SIZE", "64MB", 1);
+
+  GCL::CReaderSections reader(fileName);
+  reader.setEnvironmentPrefix("GCLTEST");
+
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 9090);
+  BOOST_TEST(*reader.tagValueString("server", "host") == "example");
+  BOOST_TEST(*reader.tagValueByteSize("CACHE", "SIZE") == 64ULL * 1024 * 1024);
+  BOOST_TEST(reader.tagLocation("server/port")->file == "<environment>");
+
+  ::unsetenv("GCLTEST_SERVER__PORT");
+  ::unsetenv("GCLTEST_CACHE__SIZE");
+}
+
+BOOST_AUTO_TEST_CASE(commandLineAboveEnvironment)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 8080\n");
+  char const *argv[] = {"program", "--server/port=7070", "--server/port=6060", "positional", "--", "--server/port=5050"};
+
+  ::setenv("GCLTEST_SERVER__PORT", "9090", 1);
+
+  GCL::CReaderSections reader(fileName);
+  reader.setEnvironmentPrefix("GCLTEST");
+  reader.setCommandLine(6, argv);
+
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 6060);
+  BOOST_TEST(reader.tagLocation("server/port")->file == "<command line>");
+
+  ::unsetenv("GCLTEST_SERVER__PORT");
+}
+
+BOOST_AUTO_TEST_CASE(layersAppliedAfterLoad)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 8080\n");
+  char const *argv[] = {"program", "--server/port=7070"};
+  std::vector<std::string> changes;
+
+  GCL::CReaderSections reader(fileName, "=", "#", true);
+  reader.addChangeCallback("server", "", [&changes](std::string_view, std::string_view tagName, std::optional<std::string_view>)
+  {
+    changes.emplace_back(tagName);
+  });
+
+  reader.setCommandLine(2, argv);
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 7070);
+
+  reader.setDefault("server/timeout", "30s");
+  BOOST_TEST(*reader.tagValueString("server", "timeout") == "30s");
+  BOOST_TEST(changes == (std::vector<std::string>{"port", "timeout"}), boost::test_tools::per_element());
+
+  reader.reload();
+  BOOST_TEST(*reader.tagValueInt32("server", "port") == 7070);
+  BOOST_TEST(*reader.tagValueString("server", "timeout") == "30s");
+  BOOST_TEST(changes.size() == 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(configurationSchema, CTemporaryDirectory)
+
+BOOST_AUTO_TEST_CASE(schemaLoadsValues)
+{
+  std::string fileName = write("main.ini", "[server]\nhost = example\nport = 8080\ntimeout = 250ms\nbuffer = 64MB\n"
+                                           "verbose = yes\nratio = 0.25\npeers = a; b\nlogfile = /var/log/server.log\n");
+
+  GCL::CReaderSections reader(fileName);
+  SServerConfig config = serverSchema.load(reader);
+
+  BOOST_TEST(config.host == "example");
+  BOOST_TEST(config.port == 8080);
+  BOOST_TEST(config.timeout.count() == 250);
+  BOOST_TEST(config.bufferSize == 64ULL * 1024 * 1024);
+  BOOST_TEST(config.verbose);
+  BOOST_TEST(config.ratio == 0.25);
+  BOOST_TEST(config.peers == (std::vector<std::string>{"a", "b"}), boost::test_tools::per_element());
+  BOOST_TEST(*config.logFile == "/var/log/server.log");
+}
+
+BOOST_AUTO_TEST_CASE(schemaUsesDefaults)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 80\n");
+
+  GCL::CReaderSections reader(fileName);
+  SServerConfig config = serverSchema.load(reader);
+
+  BOOST_TEST(config.host == "localhost");
+  BOOST_TEST(config.port == 80);
+  BOOST_TEST(config.timeout.count() == 5000);
+  BOOST_TEST(config.bufferSize == 4096);
+  BOOST_TEST(!config.verbose);
+  BOOST_TEST(config.ratio == 0.5);
+  BOOST_TEST(config.peers.empty());
+  BOOST_TEST(!config.logFile);
+}
+
+BOOST_AUTO_TEST_CASE(schemaReportsAllErrors)
+{
+  std::string fileName = write("main.ini", "[server]\ntimeout = soon\nratio = 2\n");
+
+  GCL::CReaderSections reader(fileName);
+
+  try
+  {
+    serverSchema.load(reader);
+    BOOST_FAIL("Schema errors were not reported");
+  }
+  catch(std::runtime_error const &e)
+  {
+    std::string message = e.what();
+
+    BOOST_TEST(message.find("server/port") != std::string::npos);       // Required
+    BOOST_TEST(message.find("server/timeout") != std::string::npos);    // Not a duration
+    BOOST_TEST(message.find("server/ratio") != std::string::npos);      // Out of range
+    BOOST_TEST(message.find(fileName + ":3") != std::string::npos);
+  };
+}
+
+BOOST_AUTO_TEST_CASE(schemaRangeAndTypeChecked)
+{
+  std::string fileName = write("main.ini", "[server]\nport = 70000\n");
+
+  GCL::CReaderSections reader(fileName);
+  BOOST_CHECK_THROW(serverSchema.load(reader), std::runtime_error);
+
+  write("main.ini", "[server]\nport = 65001\n");
+  reader.reload();
+  BOOST_CHECK_THROW(serverSchema.load(reader), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
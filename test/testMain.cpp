@@ -0,0 +1,35 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								testMain
+// SUBSYSTEM:						Unit tests
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Entry point for the GCL unit tests. The header only variant of Boost.Test is used so that no test library
+//                      needs to be installed. Golden files are found in GCL_TEST_DATA. Setting the environment variable
+//                      GCL_UPDATE_GOLDEN rewrites the golden files from the current output instead of comparing against them.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#define BOOST_TEST_MODULE GCL
+#include <boost/test/included/unit_test.hpp>
@@ -0,0 +1,129 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								testSQLStatic
+// SUBSYSTEM:						Unit tests
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Tests that the queries rendered by sqlStatic are the same as the equivalent queries from sqlWriter.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#include "include/SQLStatic.hpp"
+
+  // Standard C++ library header files
+
+#include <cstdint>
+#include <string>
+
+  // Miscellaneous library header files
+
+#include <boost/test/unit_test.hpp>
+
+using GCL::sqlWriter;
+namespace sqlStatic = GCL::sqlStatic;
+
+BOOST_AUTO_TEST_SUITE(sqlStaticMatchesWriter)
+
+BOOST_AUTO_TEST_CASE(select)
+{
+  constexpr auto query = sqlStatic::select<sqlWriter::POSTGRE>("ID", "Name").from("tbl_employees")
+                         .where<std::uint32_t>("ID", "=").where<std::string>("Name", "LIKE")
+                         .orderBy("Name").orderBy<sqlWriter::DESC>("ID").limit<10>();
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.select({"ID", "Name"}).from({"tbl_employees"}).where("ID", "=", std::uint32_t(12))
+        .where("Name", "LIKE", std::string("Bob%")).orderBy({{"Name", sqlWriter::ASC}, {"ID", sqlWriter::DESC}}).limit(10);
+
+  BOOST_TEST(query.string() == "SELECT ID, Name FROM tbl_employees WHERE (ID = $1) AND (Name LIKE $2) ORDER BY Name ASC, ID DESC LIMIT 10 ");
+  BOOST_TEST(query.render(12, "Bob%") == writer.string());
+}
+
+BOOST_AUTO_TEST_CASE(update)
+{
+  constexpr auto query = sqlStatic::update<sqlWriter::MYSQL>("t").set<int>("a").set<std::string>("b").where<int>("id", "=");
+  sqlWriter writer;
+
+  writer.update("t").set("a", 1).set("b", std::string("x")).where("id", "=", 3);
+  BOOST_TEST(query.render(1, "x", 3) == writer.string());
+}
+
+BOOST_AUTO_TEST_CASE(deleteFrom)
+{
+  constexpr auto query = sqlStatic::deleteFrom<sqlWriter::MICROSOFT>("t").where<int>("id", "=");
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::MICROSOFT);
+  writer.deleteFrom("t").where("id", "=", 3);
+  BOOST_TEST(query.render(3) == writer.string());
+}
+
+BOOST_AUTO_TEST_CASE(insert)
+{
+  constexpr auto query = sqlStatic::insertInto<sqlWriter::POSTGRE, int, std::string>("t", "a", "b");
+  sqlWriter writer;
+
+  writer.insertInto("t", {"a", "b"}).values({{1, std::string("x")}});
+  BOOST_TEST(query.render(1, "x") == writer.string());
+}
+
+BOOST_AUTO_TEST_CASE(bindValues)
+{
+  constexpr auto query = sqlStatic::update<sqlWriter::ORACLE>("t").set<sqlWriter::bindValue>("a").set<sqlWriter::bindValue>("b")
+                         .where<sqlWriter::bindValue>("id", "=");
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::ORACLE);
+  writer.update("t").set("a", sqlWriter::bindValue("a")).set("b", sqlWriter::bindValue(":b"))
+        .where("id", "=", sqlWriter::bindValue("?"));
+
+  std::string rendered = query.render(sqlWriter::bindValue("a"), sqlWriter::bindValue(":b"), sqlWriter::bindValue("?"));
+
+  BOOST_TEST(rendered == "UPDATE t SET a = :a, b = :b WHERE (id = ?)");
+  BOOST_TEST(rendered == writer.string());
+}
+
+BOOST_AUTO_TEST_CASE(bareBindValues)
+{
+  constexpr auto query = sqlStatic::select<sqlWriter::MYSQL>("a").from("t").where<sqlWriter::bindValue>("id", "=");
+  sqlWriter writer;
+
+  writer.select({"a"}).from("t").where("id", "=", sqlWriter::bindValue("id"));
+
+  std::string rendered = query.render(sqlWriter::bindValue("id"));
+
+  BOOST_TEST(rendered == "SELECT a FROM t WHERE (id = :id)");
+  BOOST_TEST(rendered == writer.string());
+}
+
+BOOST_AUTO_TEST_CASE(nullValues)
+{
+  constexpr auto query = sqlStatic::update<sqlWriter::MYSQL>("t").set<sqlWriter::nullValue>("a").where<int>("id", "=");
+  sqlWriter writer;
+
+  writer.update("t").set("a", sqlWriter::nullValue()).where("id", "=", 3);
+  BOOST_TEST(query.render(sqlWriter::nullValue(), 3) == writer.string());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
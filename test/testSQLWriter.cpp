@@ -0,0 +1,1101 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:							General Class Library
+// FILE:								testSQLWriter
+// SUBSYSTEM:						Unit tests
+// LANGUAGE:						C++
+// TARGET OS:						None - Standard C++
+// NAMESPACE:						GCL
+// AUTHOR:							Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Golden output tests for sqlWriter. Each query type is rendered in every dialect and compared against the
+//                      files in data/sql/<dialect>/<query>.sql.
+//
+// HISTORY:             2026-10-18 GGB - File created.
+//
+//*********************************************************************************************************************************
+
+#include "include/SQLWriter.h"
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+  // Miscellaneous library header files
+
+#include <boost/test/unit_test.hpp>
+
+  // GCL library header files
+
+#include "include/error.h"
+
+  // Test header files
+
+#include "golden.h"
+
+using GCL::sqlWriter;
+
+namespace
+{
+  std::array<std::pair<sqlWriter::EDialect, char const *>, 4> const dialects
+  {{
+    { sqlWriter::MYSQL, "mysql" },
+    { sqlWriter::ORACLE, "oracle" },
+    { sqlWriter::MICROSOFT, "microsoft" },
+    { sqlWriter::POSTGRE, "postgre" },
+  }};
+
+  /// @brief      Renders the query in every dialect and compares it with data/sql/<dialect>/<name>.sql
+  /// @param[in]  name: The name of the golden file.
+  /// @param[in]  build: Function to build the query on the writer.
+
+  template<typename F>
+  void checkDialects(std::string const &name, F build)
+  {
+    for (auto const &[dialect, directory] : dialects)
+    {
+      sqlWriter writer;
+
+      writer.setDialect(dialect);
+      build(writer);
+      GCL::test::checkGolden("sql/" + std::string(directory) + "/" + name + ".sql", writer.string());
+    };
+  }
+
+  /// @brief      Creates the tables and columns of data/sql/database.map and reads the map file.
+  /// @param[in]  writer: The writer to set up.
+
+  void readDatabaseMap(sqlWriter &writer)
+  {
+    writer.createTable("employees");
+    writer.createColumn("employees", "name");
+    writer.createColumn("employees", "deptID");
+    writer.createTable("departments");
+    writer.createColumn("departments", "ID");
+    writer.readMapFile(GCL::test::dataFile("sql/database.map"));
+  }
+
+  /// @brief      Builds the query used by the hint tests in a dialect.
+  /// @param[in]  dialect: The dialect.
+  /// @param[in]  hint: The index hint.
+  /// @returns    The rendered query.
+
+  std::string hintQuery(sqlWriter::EDialect dialect, sqlWriter::EIndexHint hint)
+  {
+    sqlWriter writer;
+
+    writer.setDialect(dialect);
+    writer.select({"ID"}).from("orders", "o").indexHint("orders", hint, {"idx_customer"}).queryHint("MAXDOP 1");
+    return writer.string();
+  }
+
+    // Exposes the single name mapping functions.
+
+  class CMapWriter : public sqlWriter
+  {
+  public:
+    using sqlWriter::setTableMap;
+    using sqlWriter::setColumnMap;
+  };
+
+    // Stream buffer that fails every write.
+
+  class CFailingBuffer : public std::streambuf
+  {
+  protected:
+    int_type overflow(int_type) override { throw std::runtime_error("write failed"); }
+    std::streamsize xsputn(char const *, std::streamsize) override { throw std::runtime_error("write failed"); }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(sqlWriterGolden)
+
+BOOST_AUTO_TEST_CASE(select)
+{
+  checkDialects("select", [](sqlWriter &writer)
+  {
+    writer.select({"ID", "Name"}).from("tbl_users").where("ID", ">", 10).orderBy({{"Name", sqlWriter::ASC}}).limit(5).offset(10);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(selectDistinct)
+{
+  checkDialects("selectDistinct", [](sqlWriter &writer)
+  {
+    writer.select({"Name"}).distinct().from("tbl_users").orderBy({{"Name", sqlWriter::ASC}}).limit(5);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(groupByRollup)
+{
+  checkDialects("groupByRollup", [](sqlWriter &writer)
+  {
+    writer.select({"region", "product"}).sum("amount", "total").from("sales").groupBy({"region", "product"}, true);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(commonTable)
+{
+  checkDialects("commonTable", [](sqlWriter &writer)
+  {
+    sqlWriter recent = writer.fork();     // The subquery is rendered in the dialect of the writer.
+
+    recent.select({"customer", "amount"}).from("orders").where("orderDate", ">", std::string("2026-01-01"));
+    writer.with("recent", recent).select({"customer"}).sum("amount", "total").from("recent").groupBy({"customer"});
+  });
+}
+
+BOOST_AUTO_TEST_CASE(recursiveCommonTable)
+{
+  checkDialects("recursiveCommonTable", [](sqlWriter &writer)
+  {
+    sqlWriter anchor = writer.fork();
+    sqlWriter recursive = writer.fork();
+
+    anchor.select({"ID", "Parent"}).from("nodes").where("ID", "=", 1);
+    recursive.select({"nodes.ID", "nodes.Parent"}).from({"nodes"})
+             .join({std::make_tuple(std::string("nodes"), std::string("Parent"), sqlWriter::JOIN_INNER,
+                                    std::string("tree"), std::string("ID"))});
+    writer.withRecursive("tree", anchor, recursive, {"ID", "Parent"}).select({"ID"}).from("tree");
+  });
+}
+
+BOOST_AUTO_TEST_CASE(windowFunctions)
+{
+  checkDialects("windowFunctions", [](sqlWriter &writer)
+  {
+    writer.select({"customer", "amount"})
+          .window(sqlWriter::WIN_ROW_NUMBER, "", {"customer"}, {{"orderDate", sqlWriter::DESC}}, "rn")
+          .window(sqlWriter::WIN_LAG, "amount", {"customer"}, {{"orderDate", sqlWriter::ASC}}, "previous")
+          .window(sqlWriter::AGG_SUM, "amount", {"customer"}, {}, "total")
+          .from("orders");
+  });
+}
+
+BOOST_AUTO_TEST_CASE(insert)
+{
+  checkDialects("insert", [](sqlWriter &writer)
+  {
+    writer.insertInto("tbl_users", {"ID", "Name"}).values({{1, std::string("Alice")}, {2, std::string("Bob")}});
+  });
+}
+
+BOOST_AUTO_TEST_CASE(update)
+{
+  checkDialects("update", [](sqlWriter &writer)
+  {
+    writer.update("tbl_users").set("Name", std::string("Carol")).where("ID", "=", 3);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(deleteFrom)
+{
+  checkDialects("delete", [](sqlWriter &writer)
+  {
+    writer.deleteFrom("tbl_users").where("ID", "=", 4);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(upsert)
+{
+  checkDialects("upsert", [](sqlWriter &writer)
+  {
+    writer.upsert("tbl_users").set("Name", std::string("Dave")).where("ID", "=", 5);
+  });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterRender)
+
+BOOST_AUTO_TEST_CASE(fromAlias)
+{
+  sqlWriter writer;
+
+  writer.select({"a"}).from("tbl_one", "o");
+  BOOST_TEST(writer.string() == "SELECT a FROM tbl_one AS o");
+
+  writer.setDialect(sqlWriter::ORACLE);
+  BOOST_TEST(writer.string() == "SELECT a FROM tbl_one o");
+}
+
+BOOST_AUTO_TEST_CASE(joinSpacing)
+{
+  sqlWriter writer;
+
+  writer.select({"a"}).from({"t"}).join({std::make_tuple(std::string("t"), std::string("id"), sqlWriter::JOIN_FULL,
+                                                         std::string("u"), std::string("tid"))});
+  BOOST_TEST(writer.string() == "SELECT a FROM t FULL JOIN u ON t.id=u.tid");
+}
+
+BOOST_AUTO_TEST_CASE(keysetColumnsOrderFirst)
+{
+  sqlWriter writer;
+
+  writer.select({"ID", "Name"}).from("tbl_users").orderBy({{"Name", sqlWriter::ASC}}).keyset({"ID"}, {100}, 20);
+  BOOST_TEST(writer.string() == "SELECT ID, Name FROM tbl_users WHERE (ID > 100) ORDER BY ID ASC, Name ASC LIMIT 20 ");
+}
+
+BOOST_AUTO_TEST_CASE(keysetReplacesEarlierKey)
+{
+  sqlWriter writer;
+
+  writer.select({"ID"}).from("tbl_users").keyset({"ID"}, {}, 20).orderBy({{"Name", sqlWriter::DESC}});
+  writer.keyset({"Created", "ID"}, {}, 10, sqlWriter::DESC);
+  BOOST_TEST(writer.string() == "SELECT ID FROM tbl_users ORDER BY Created DESC, ID DESC, Name DESC LIMIT 10 ");
+}
+
+BOOST_AUTO_TEST_CASE(whereBindValuesPrefixed)
+{
+  sqlWriter writer;
+
+  writer.select({"a"}).from("t").where("ID", "=", sqlWriter::bindValue("id")).where("Name", "=", sqlWriter::bindValue(":name"))
+        .where("Age", ">", sqlWriter::bindValue("?"));
+  writer.where(writer.predicateCompare("Code", "=", sqlWriter::bindValue("code")));
+  BOOST_TEST(writer.string() == "SELECT a FROM t WHERE (ID = :id) AND (Name = :name) AND (Age > ?) AND (Code = :code)");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterIdentifier)
+
+BOOST_AUTO_TEST_CASE(emptyIdentifier)
+{
+  sqlWriter::identifier empty;
+
+  BOOST_TEST(empty.empty());
+  BOOST_TEST(empty.str().empty());
+  BOOST_TEST(empty.quoted(sqlWriter::MYSQL).empty());
+  BOOST_TEST((empty == sqlWriter::identifier("")));
+}
+
+BOOST_AUTO_TEST_CASE(internedOncePerName)
+{
+  std::vector<std::thread> threads;
+  std::vector<std::vector<std::uint64_t>> keys(8);
+
+  for (std::size_t thread = 0; thread < keys.size(); thread++)
+  {
+    threads.emplace_back([thread, &keys]()
+    {
+      for (int index = 0; index < 1000; index++)
+      {
+        keys[thread].push_back(sqlWriter::identifier("column" + std::to_string(index)).key());
+      };
+    });
+  };
+  for (auto &thread : threads)
+  {
+    thread.join();
+  };
+
+  for (std::size_t thread = 1; thread < keys.size(); thread++)
+  {
+    BOOST_TEST(keys[thread] == keys[0]);
+  };
+  BOOST_TEST(sqlWriter::identifier("column7").quoted(sqlWriter::MICROSOFT) == "[column7]");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterParallel)
+
+BOOST_AUTO_TEST_CASE(renderQueriesInOrder)
+{
+  std::vector<sqlWriter> queries(1001);
+
+  for (std::size_t index = 0; index < queries.size(); index++)
+  {
+    queries[index].select({"a"}).from("t").where("ID", "=", static_cast<int>(index));
+  };
+
+  for (std::size_t threadCount : {1, 3, 8})
+  {
+    sqlWriter::renderedQueries rendered = sqlWriter::renderQueries(queries, threadCount);
+
+    BOOST_TEST(rendered.size() == queries.size());
+    BOOST_TEST(rendered.buffers().size() == threadCount);
+    for (std::size_t index = 0; index < queries.size(); index++)
+    {
+      BOOST_TEST(rendered[index] == queries[index].string());
+    };
+  };
+}
+
+BOOST_AUTO_TEST_CASE(renderQueriesToStream)
+{
+  std::vector<sqlWriter> queries(3000);
+  std::ostringstream expected;
+  std::ostringstream os;
+
+  for (std::size_t index = 0; index < queries.size(); index++)
+  {
+    queries[index].deleteFrom("t").where("ID", "=", static_cast<int>(index));
+    expected << queries[index].string() << ";\n";
+  };
+
+  sqlWriter::renderQueries(queries, os, 4);
+  BOOST_TEST(os.str() == expected.str());
+}
+
+BOOST_AUTO_TEST_CASE(renderQueriesStreamThrows)
+{
+  std::vector<sqlWriter> queries(20000);
+  CFailingBuffer buffer;
+  std::ostream os(&buffer);
+
+  for (std::size_t index = 0; index < queries.size(); index++)
+  {
+    queries[index].deleteFrom("t").where("ID", "=", static_cast<int>(index));
+  };
+
+  os.exceptions(std::ios::badbit);
+  BOOST_CHECK_THROW(sqlWriter::renderQueries(queries, os, 2), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(renderNoQueries)
+{
+  sqlWriter::renderedQueries rendered = sqlWriter::renderQueries({}, 4);
+
+  BOOST_TEST(rendered.empty());
+  BOOST_TEST(rendered.buffers().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterFingerprint)
+
+BOOST_AUTO_TEST_CASE(equalQueriesEqualFingerprints)
+{
+  sqlWriter first, second;
+
+  first.select({"a"}).from("t").where("ID", "=", 42).where("Name", "=", std::string("x"));
+  second.select({"a"}).from("t").where("ID", "=", 42).where("Name", "=", std::string("x"));
+  BOOST_TEST((first.fingerprint() == second.fingerprint()));
+}
+
+BOOST_AUTO_TEST_CASE(valuesAndTypesDistinguished)
+{
+  auto fingerprint = [](sqlWriter::parameter const &value)
+  {
+    sqlWriter writer;
+
+    writer.select({"a"}).from("t").where("ID", "=", value);
+    return writer.fingerprint();
+  };
+
+  BOOST_TEST(!(fingerprint(1) == fingerprint(2)));
+  BOOST_TEST(!(fingerprint(1) == fingerprint(std::string("1"))));
+  BOOST_TEST(!(fingerprint(1) == fingerprint(1.0)));
+  BOOST_TEST(!(fingerprint(std::string("a")) == fingerprint(sqlWriter::bindValue("a"))));
+  BOOST_TEST(!(fingerprint(sqlWriter::bindValue("a")) == fingerprint(sqlWriter::bindValue("b"))));
+  BOOST_TEST((fingerprint(sqlWriter::nullValue()) == fingerprint(sqlWriter::nullValue())));
+}
+
+BOOST_AUTO_TEST_CASE(validationDistinguished)
+{
+  sqlWriter first, second;
+
+  readDatabaseMap(first);
+  readDatabaseMap(second);
+  second.setValidation(true);
+  first.select({"name"}).from("employees");
+  second.select({"name"}).from("employees");
+  BOOST_TEST(!(first.fingerprint() == second.fingerprint()));
+}
+
+BOOST_AUTO_TEST_CASE(cachedQueriesRenderValues)
+{
+  auto cache = std::make_shared<sqlWriter::queryCache>(16);
+
+  for (int value : {1, 2, 1})
+  {
+    sqlWriter writer;
+
+    writer.setQueryCache(cache);
+    writer.select({"a"}).from("t").where("ID", "=", value);
+    BOOST_TEST(writer.string() == "SELECT a FROM t WHERE (ID = " + std::to_string(value) + ")");
+  };
+}
+
+BOOST_AUTO_TEST_CASE(mapChangesNotServedFromCache)
+{
+  auto cache = std::make_shared<sqlWriter::queryCache>(16);
+  CMapWriter writer;
+
+  writer.setQueryCache(cache);
+  writer.createTable("employees");
+  writer.createColumn("employees", "name");
+  writer.createColumn("employees", "deptID");
+  writer.createTable("departments");
+  writer.createColumn("departments", "ID");
+  writer.select({"name"}).from("employees");
+  BOOST_TEST(writer.string() == "SELECT name FROM employees");
+
+  writer.readMapFile(GCL::test::dataFile("sql/database.map"));
+  BOOST_TEST(writer.string() == "SELECT emp_name FROM tbl_emp");
+
+  writer.setTableMap("employees", "staff");
+  BOOST_TEST(writer.string() == "SELECT emp_name FROM staff");
+
+  writer.setColumnMap("employees", "name", "full_name");
+  BOOST_TEST(writer.string() == "SELECT full_name FROM staff");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterPredicate)
+
+BOOST_AUTO_TEST_CASE(inListChunked)
+{
+  sqlWriter writer;
+
+  writer.setInListLimit(2);
+  writer.select({"a"}).from("t").where(writer.predicateIn("ID", {1, 2, 3, 4, 5}));
+  BOOST_TEST(writer.string() == "SELECT a FROM t WHERE ((ID IN (1, 2)) OR (ID IN (3, 4)) OR (ID IN (5)))");
+
+  writer.resetWhere();
+  writer.where(writer.predicateNotIn("ID", {1, 2, 3}));
+  BOOST_TEST(writer.string() == "SELECT a FROM t WHERE ((ID NOT IN (1, 2)) AND (ID NOT IN (3)))");
+}
+
+BOOST_AUTO_TEST_CASE(inListOracleDefaultLimit)
+{
+  sqlWriter writer;
+  sqlWriter::parameterStorage values;
+
+  for (int index = 0; index < 1001; index++)
+  {
+    values.emplace_back(index);
+  };
+
+  writer.setDialect(sqlWriter::ORACLE);
+  writer.select({"a"}).from("t").where(writer.predicateIn("ID", values));
+  BOOST_TEST(writer.string().find(", 999)) OR (ID IN (1000)))") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(emptyInList)
+{
+  sqlWriter writer;
+
+  writer.select({"a"}).from("t").where(writer.predicateIn("ID", sqlWriter::parameterStorage()));
+  BOOST_TEST(writer.string() == "SELECT a FROM t WHERE (1 = 0)");
+
+  writer.resetWhere();
+  writer.where(writer.predicateNotIn("ID", sqlWriter::parameterStorage()));
+  BOOST_TEST(writer.string() == "SELECT a FROM t WHERE (1 = 1)");
+}
+
+BOOST_AUTO_TEST_CASE(notOrNesting)
+{
+  sqlWriter writer;
+
+  writer.select({"a"}).from("t");
+  writer.where(writer.predicateNot(writer.predicateOr({writer.predicateCompare("A", "=", 1),
+                                                       writer.predicateAnd({writer.predicateIsNull("B"),
+                                                                            writer.predicateCompare("C", "<", 2)})})));
+  writer.where(writer.predicateIsNotNull("D"));
+  BOOST_TEST(writer.string() ==
+             "SELECT a FROM t WHERE (NOT ((A = 1) OR ((B IS NULL) AND (C < 2)))) AND (D IS NOT NULL)");
+}
+
+BOOST_AUTO_TEST_CASE(between)
+{
+  sqlWriter writer;
+
+  writer.select({"a"}).from("t").where(writer.predicateBetween("Created", std::string("2026-01-01"), std::string("2026-12-31")));
+  BOOST_TEST(writer.string() == "SELECT a FROM t WHERE (Created BETWEEN '2026-01-01' AND '2026-12-31')");
+}
+
+BOOST_AUTO_TEST_CASE(exists)
+{
+  sqlWriter subQuery, writer;
+
+  subQuery.select({"ID"}).from("orders").where("Status", "=", std::string("open"));
+  writer.select({"Name"}).from("customers").where(writer.predicateExists(subQuery));
+  BOOST_TEST(writer.string() == "SELECT Name FROM customers WHERE (EXISTS (SELECT ID FROM orders WHERE (Status = 'open')))");
+}
+
+BOOST_AUTO_TEST_CASE(inSubquery)
+{
+  sqlWriter subQuery, writer;
+
+  subQuery.select({"CustomerID"}).from("orders");
+  writer.select({"Name"}).from("customers").where(writer.predicateIn("ID", subQuery));
+  BOOST_TEST(writer.string() == "SELECT Name FROM customers WHERE (ID IN (SELECT CustomerID FROM orders))");
+}
+
+BOOST_AUTO_TEST_CASE(foreignHandleRejected)
+{
+  sqlWriter first, second;
+
+  first.select({"a"}).from("t");
+  second.select({"a"}).from("t");
+
+  sqlWriter::predicate_t firstHandle = first.predicateIsNull("A");
+  sqlWriter::predicate_t secondHandle = second.predicateIsNull("B");
+
+    // Both handles have index 0, but each belongs to one writer.
+
+  BOOST_TEST(firstHandle.index == secondHandle.index);
+  BOOST_CHECK_THROW(first.where(secondHandle), GCL::CRuntimeAssert);
+  BOOST_CHECK_THROW(first.predicateNot(secondHandle), GCL::CRuntimeAssert);
+  BOOST_CHECK_THROW(first.predicateAnd({firstHandle, secondHandle}), GCL::CRuntimeAssert);
+
+  first.where(firstHandle);
+  BOOST_TEST(first.string() == "SELECT a FROM t WHERE (A IS NULL)");
+
+  first.resetWhere();
+  BOOST_CHECK_THROW(first.where(firstHandle), GCL::CRuntimeAssert);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterAggregate)
+
+BOOST_AUTO_TEST_CASE(aggregates)
+{
+  sqlWriter writer;
+
+  writer.select({"region"}).aggregate(sqlWriter::AGG_COUNT, "*", "n").aggregate(sqlWriter::AGG_COUNT_DISTINCT, "customer")
+        .sum("amount", "total").avg("amount").aggregate(sqlWriter::AGG_MIN, "amount").aggregate(sqlWriter::AGG_MAX, "amount")
+        .from("sales").groupBy({"region"});
+  BOOST_TEST(writer.string() == "SELECT region, COUNT(*) AS n, COUNT(DISTINCT customer), SUM(amount) AS total, AVG(amount), "
+                                "MIN(amount), MAX(amount) FROM sales GROUP BY region");
+}
+
+BOOST_AUTO_TEST_CASE(having)
+{
+  sqlWriter writer;
+
+  writer.select({"region"}).sum("amount").from("sales").groupBy({"region"})
+        .having(sqlWriter::AGG_SUM, "amount", ">", 1000).having("region", "<>", std::string("north"));
+  BOOST_TEST(writer.string() ==
+             "SELECT region, SUM(amount) FROM sales GROUP BY region HAVING (SUM(amount) > 1000) AND (region <> 'north')");
+}
+
+BOOST_AUTO_TEST_CASE(rollupPerDialect)
+{
+  sqlWriter writer;
+
+  writer.select({"region"}).sum("amount").from("sales").groupBy({"region"}, true);
+
+  writer.setDialect(sqlWriter::MYSQL);
+  BOOST_TEST(writer.string() == "SELECT region, SUM(amount) FROM sales GROUP BY region WITH ROLLUP");
+  for (sqlWriter::EDialect dialect : {sqlWriter::POSTGRE, sqlWriter::MICROSOFT, sqlWriter::ORACLE})
+  {
+    writer.setDialect(dialect);
+    BOOST_TEST(writer.string() == "SELECT region, SUM(amount) FROM sales GROUP BY ROLLUP (region)");
+  };
+}
+
+BOOST_AUTO_TEST_CASE(columnsValidated)
+{
+  auto validatingWriter = []()
+  {
+    sqlWriter writer;
+
+    readDatabaseMap(writer);
+    writer.setValidation(true);
+    return writer;
+  };
+
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).sum("zz"), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).aggregate(sqlWriter::AGG_COUNT_DISTINCT, "zz"), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).from("employees").having("zz", "=", 1), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).from("employees").having(sqlWriter::AGG_SUM, "zz", ">", 1),
+                    GCL::runtime_error);
+
+  sqlWriter writer = validatingWriter();
+
+  writer.select({"deptID"}).aggregate(sqlWriter::AGG_COUNT, "*", "n").aggregate(sqlWriter::AGG_COUNT, "name")
+        .from("employees").groupBy({"deptID"}).having(sqlWriter::AGG_COUNT, "name", ">", 5).having("deptID", "<>", 3);
+  BOOST_TEST(writer.string() == "SELECT dept_id, COUNT(*) AS n, COUNT(emp_name) FROM tbl_emp GROUP BY dept_id "
+                                "HAVING (COUNT(emp_name) > 5) AND (dept_id <> 3)");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterHint)
+
+BOOST_AUTO_TEST_CASE(mysqlHints)
+{
+  BOOST_TEST(hintQuery(sqlWriter::MYSQL, sqlWriter::HINT_USE_INDEX) ==
+             "SELECT /*+ MAXDOP 1 */ ID FROM orders AS o USE INDEX (idx_customer)");
+  BOOST_TEST(hintQuery(sqlWriter::MYSQL, sqlWriter::HINT_FORCE_INDEX) ==
+             "SELECT /*+ MAXDOP 1 */ ID FROM orders AS o FORCE INDEX (idx_customer)");
+  BOOST_TEST(hintQuery(sqlWriter::MYSQL, sqlWriter::HINT_IGNORE_INDEX) ==
+             "SELECT /*+ MAXDOP 1 */ ID FROM orders AS o IGNORE INDEX (idx_customer)");
+}
+
+BOOST_AUTO_TEST_CASE(microsoftHints)
+{
+  BOOST_TEST(hintQuery(sqlWriter::MICROSOFT, sqlWriter::HINT_USE_INDEX) ==
+             "SELECT ID FROM orders AS o WITH (INDEX(idx_customer)) OPTION (MAXDOP 1)");
+  BOOST_TEST(hintQuery(sqlWriter::MICROSOFT, sqlWriter::HINT_FORCE_INDEX) ==
+             "SELECT ID FROM orders AS o WITH (INDEX(idx_customer)) OPTION (MAXDOP 1)");
+  BOOST_CHECK_THROW(hintQuery(sqlWriter::MICROSOFT, sqlWriter::HINT_IGNORE_INDEX), GCL::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(oracleHints)
+{
+  BOOST_TEST(hintQuery(sqlWriter::ORACLE, sqlWriter::HINT_FORCE_INDEX) ==
+             "SELECT /*+ INDEX(o idx_customer) MAXDOP 1 */ ID FROM orders o");
+  BOOST_TEST(hintQuery(sqlWriter::ORACLE, sqlWriter::HINT_IGNORE_INDEX) ==
+             "SELECT /*+ NO_INDEX(o idx_customer) MAXDOP 1 */ ID FROM orders o");
+}
+
+BOOST_AUTO_TEST_CASE(postgreHints)
+{
+  BOOST_TEST(hintQuery(sqlWriter::POSTGRE, sqlWriter::HINT_USE_INDEX) ==
+             "/*+ IndexScan(o idx_customer) MAXDOP 1 */ SELECT ID FROM orders AS o");
+  BOOST_TEST(hintQuery(sqlWriter::POSTGRE, sqlWriter::HINT_IGNORE_INDEX) ==
+             "/*+ NoIndexScan(o) MAXDOP 1 */ SELECT ID FROM orders AS o");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterBatch)
+
+BOOST_AUTO_TEST_CASE(updateBatchGolden)
+{
+  checkDialects("updateBatch", [](sqlWriter &writer)
+  {
+    writer.updateBatch("tbl_prices", "ID", {"Price", "Name"})
+          .values({{1, 10.5, std::string("A")}, {2, 11, std::string("B")}});
+  });
+}
+
+BOOST_AUTO_TEST_CASE(updateBatchCase)
+{
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::MYSQL);
+  writer.updateBatch("tbl_prices", "ID", {"Price"}).values({{1, 10.5}, {2, 11}});
+  BOOST_TEST(writer.string() == "UPDATE tbl_prices SET Price = CASE ID WHEN 1 THEN 10.5 WHEN 2 THEN 11 ELSE Price END "
+                                "WHERE ID IN (1, 2)");
+}
+
+BOOST_AUTO_TEST_CASE(updateBatchValues)
+{
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.updateBatch("tbl_prices", "ID", {"Price"}).values({{1, 10.5}, {2, 11}});
+  BOOST_TEST(writer.string() == "UPDATE tbl_prices SET Price = v.Price FROM (VALUES (1, 10.5), (2, 11)) AS v(ID, Price) "
+                                "WHERE tbl_prices.ID = v.ID");
+}
+
+BOOST_AUTO_TEST_CASE(stringsSplitByLength)
+{
+  for (sqlWriter::EDialect dialect : {sqlWriter::MYSQL, sqlWriter::POSTGRE})
+  {
+    sqlWriter writer;
+
+    writer.setDialect(dialect);
+    writer.updateBatch("tbl_prices", "ID", {"Price"});
+    for (int row = 0; row < 50; row++)
+    {
+      writer.values({{row, row * 10}});
+    };
+
+    std::size_t maxLength = 200;
+    std::vector<std::string> statements = writer.strings(maxLength);
+    std::size_t rows = 0;
+
+    BOOST_TEST(statements.size() > 1);
+    for (auto const &statement : statements)
+    {
+      BOOST_TEST(statement.size() <= maxLength);
+      rows += (dialect == sqlWriter::POSTGRE) ? std::count(statement.begin(), statement.end(), '(') - 2
+                                              : std::count(statement.begin(), statement.end(), ',') + 1;
+    };
+    BOOST_TEST(rows == 50);
+
+      // A single statement if there is no limit.
+
+    BOOST_TEST(writer.strings(std::numeric_limits<std::size_t>::max()).size() == 1);
+    BOOST_TEST(writer.strings(std::numeric_limits<std::size_t>::max()).front() == writer.string());
+  };
+}
+
+BOOST_AUTO_TEST_CASE(stringsSplitByRows)
+{
+  sqlWriter writer;
+
+  writer.setInListLimit(2);
+  writer.updateBatch("tbl_prices", "ID", {"Price"}).values({{1, 10}, {2, 20}, {3, 30}});
+
+  std::vector<std::string> statements = writer.strings(std::numeric_limits<std::size_t>::max());
+
+  BOOST_TEST(statements.size() == 2);
+  BOOST_TEST(statements[0] == "UPDATE tbl_prices SET Price = CASE ID WHEN 1 THEN 10 WHEN 2 THEN 20 ELSE Price END "
+                             "WHERE ID IN (1, 2)");
+  BOOST_TEST(statements[1] == "UPDATE tbl_prices SET Price = CASE ID WHEN 3 THEN 30 ELSE Price END WHERE ID IN (3)");
+}
+
+BOOST_AUTO_TEST_CASE(stringsLongRowAlone)
+{
+  sqlWriter writer;
+
+  writer.updateBatch("tbl_names", "ID", {"Name"}).values({{1, std::string("a")}, {2, std::string(300, 'b')}, {3, std::string("c")}});
+
+  std::vector<std::string> statements = writer.strings(120);
+
+  BOOST_TEST(statements.size() == 3);
+  BOOST_TEST(statements[1].size() > 300);
+  BOOST_TEST(statements[1].find("WHERE ID IN (2)") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(stringsOtherQueries)
+{
+  sqlWriter writer;
+
+  writer.select({"a"}).from("t");
+  BOOST_TEST(writer.strings(5) == std::vector<std::string>{writer.string()}, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterBulk)
+
+BOOST_AUTO_TEST_CASE(copyStatements)
+{
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.bulkLoad("tbl_users", {"ID", "Name"});
+  BOOST_TEST(writer.string() == "COPY tbl_users (ID, Name) FROM STDIN");
+
+  writer.bulkLoad("tbl_users", {"ID", "Name"}, sqlWriter::BULK_CSV);
+  BOOST_TEST(writer.string() == "COPY tbl_users (ID, Name) FROM STDIN WITH (FORMAT csv)");
+}
+
+BOOST_AUTO_TEST_CASE(loadDataStatements)
+{
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::MYSQL);
+  writer.bulkLoad("tbl_users", {"ID", "Name"}, sqlWriter::BULK_TEXT, "C:\\data\\o'brien.txt");
+  BOOST_TEST(writer.string() == "LOAD DATA LOCAL INFILE 'C:\\\\data\\\\o''brien.txt' INTO TABLE tbl_users "
+                                "FIELDS TERMINATED BY '\\t' ESCAPED BY '\\\\' LINES TERMINATED BY '\\n' (ID, Name)");
+
+  writer.bulkLoad("tbl_users", {"ID", "Name"}, sqlWriter::BULK_CSV, "users.csv");
+  BOOST_TEST(writer.string() == "LOAD DATA LOCAL INFILE 'users.csv' INTO TABLE tbl_users "
+                                "FIELDS TERMINATED BY ',' OPTIONALLY ENCLOSED BY '\"' ESCAPED BY '' "
+                                "LINES TERMINATED BY '\\n' (ID, Name)");
+
+  writer.bulkLoad("tbl_users", {"ID", "Name"});
+  BOOST_CHECK_THROW(writer.string(), GCL::CRuntimeAssert);
+}
+
+BOOST_AUTO_TEST_CASE(unsupportedDialect)
+{
+  sqlWriter writer;
+
+  writer.setDialect(sqlWriter::MICROSOFT);
+  writer.bulkLoad("tbl_users", {"ID"});
+  BOOST_CHECK_THROW(writer.string(), GCL::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(textEscaping)
+{
+  sqlWriter writer;
+  std::ostringstream os;
+
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.bulkLoad("tbl_users", {"ID", "Name"});
+
+  {
+    sqlWriter::bulkLoadWriter bulkWriter = writer.bulkWriter(os);
+
+    bulkWriter.writeRow({1, std::string("tab\there")});
+    bulkWriter.writeRow({2, std::string("back\\slash")});
+    bulkWriter.writeRow({3, std::string("new\nline\r")});
+    bulkWriter.writeRow({4, std::string("\"quoted\"")});
+    bulkWriter.writeRow({5, sqlWriter::nullValue()});
+    BOOST_TEST(bulkWriter.rows() == 5);
+  }
+
+  BOOST_TEST(os.str() == "1\ttab\\there\n"
+                         "2\tback\\\\slash\n"
+                         "3\tnew\\nline\\r\n"
+                         "4\t\"quoted\"\n"
+                         "5\t\\N\n");
+}
+
+BOOST_AUTO_TEST_CASE(csvQuoting)
+{
+  sqlWriter writer;
+  std::ostringstream os;
+
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.bulkLoad("tbl_users", {"ID", "Name"}, sqlWriter::BULK_CSV);
+
+  {
+    sqlWriter::bulkLoadWriter bulkWriter = writer.bulkWriter(os);
+
+    bulkWriter.writeRow({1, std::string("say \"hi\", ok")});
+    bulkWriter.writeRow({2, std::string("tab\tand\nnewline")});
+    bulkWriter.writeRow({3, sqlWriter::nullValue()});
+    bulkWriter.writeRow({4, std::string()});
+  }
+
+  BOOST_TEST(os.str() == "1,\"say \"\"hi\"\", ok\"\n"
+                         "2,\"tab\tand\nnewline\"\n"
+                         "3,\n"
+                         "4,\"\"\n");
+}
+
+BOOST_AUTO_TEST_CASE(mysqlValues)
+{
+  sqlWriter writer;
+  std::ostringstream text, csv;
+
+  writer.setDialect(sqlWriter::MYSQL);
+  writer.bulkLoad("tbl_users", {"ID", "Active", "Name"}, sqlWriter::BULK_TEXT, "users.txt");
+
+  {
+    sqlWriter::bulkLoadWriter bulkWriter = writer.bulkWriter(text);
+
+    bulkWriter.writeRow({1, true, sqlWriter::nullValue()});
+    bulkWriter.writeRow({2, false, std::string("nul\0", 4)});
+  }
+  BOOST_TEST(text.str() == "1\t1\t\\N\n2\t0\tnul\\0\n");
+
+  writer.bulkLoad("tbl_users", {"ID", "Active", "Name"}, sqlWriter::BULK_CSV, "users.csv");
+
+  {
+    sqlWriter::bulkLoadWriter bulkWriter = writer.bulkWriter(csv);
+
+    bulkWriter.writeRow({1, true, sqlWriter::nullValue()});
+  }
+  BOOST_TEST(csv.str() == "1,1,NULL\n");
+}
+
+BOOST_AUTO_TEST_CASE(bufferFlushed)
+{
+  sqlWriter writer;
+  std::ostringstream os;
+
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.bulkLoad("tbl_users", {"ID"});
+
+  sqlWriter::bulkLoadWriter bulkWriter = writer.bulkWriter(os);
+
+  for (int row = 0; row < 100000; row++)
+  {
+    bulkWriter.writeRow({row});
+  };
+
+    // Full buffers are written as the rows are added.
+
+  BOOST_TEST(!os.str().empty());
+  bulkWriter.flush();
+
+  std::string data = os.str();
+
+  BOOST_TEST(std::count(data.begin(), data.end(), '\n') == 100000);
+  BOOST_CHECK_THROW(bulkWriter.writeRow({1, 2}), GCL::CRuntimeAssert);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterFork)
+
+BOOST_AUTO_TEST_CASE(forkSharesClauses)
+{
+  sqlWriter base;
+
+  base.select({"ID", "Name"}).from("tbl_users").where("Active", "=", 1).orderBy({{"Name", sqlWriter::ASC}});
+
+  sqlWriter fork = base.fork();
+
+  BOOST_TEST(fork.sharedClauses(base) == 4);
+  BOOST_TEST(fork.string() == base.string());
+}
+
+BOOST_AUTO_TEST_CASE(forkMutationsIsolated)
+{
+  sqlWriter base;
+
+  base.select({"ID", "Name"}).from("tbl_users").where("Active", "=", 1).orderBy({{"Name", sqlWriter::ASC}});
+
+  std::string baseQuery = base.string();
+  sqlWriter first = base.fork();
+  sqlWriter second = base.fork();
+
+  first.where("ID", "=", 1);
+  second.where("ID", "=", 2).orderBy({{"ID", sqlWriter::DESC}});
+
+    // Only the modified clauses are copied.
+
+  BOOST_TEST(first.sharedClauses(base) == 3);
+  BOOST_TEST(second.sharedClauses(base) == 2);
+  BOOST_TEST(base.string() == baseQuery);
+  BOOST_TEST(first.string() == "SELECT ID, Name FROM tbl_users WHERE (Active = 1) AND (ID = 1) ORDER BY Name ASC ");
+  BOOST_TEST(second.string() == "SELECT ID, Name FROM tbl_users WHERE (Active = 1) AND (ID = 2) ORDER BY Name ASC, ID DESC ");
+}
+
+BOOST_AUTO_TEST_CASE(forkPredicates)
+{
+  sqlWriter base;
+
+  base.select({"a"}).from("t");
+
+  sqlWriter::predicate_t shared = base.predicateIsNull("A");
+  sqlWriter fork = base.fork();
+  sqlWriter::predicate_t forkOnly = fork.predicateIsNull("B");
+
+  fork.where(shared).where(forkOnly);
+  BOOST_TEST(fork.string() == "SELECT a FROM t WHERE (A IS NULL) AND (B IS NULL)");
+  BOOST_CHECK_THROW(base.where(forkOnly), GCL::CRuntimeAssert);
+  BOOST_TEST(base.string() == "SELECT a FROM t");
+}
+
+BOOST_AUTO_TEST_CASE(forkSharesMap)
+{
+  sqlWriter base;
+
+  readDatabaseMap(base);
+
+  sqlWriter fork = base.fork();
+
+  BOOST_TEST(fork.databaseMap() == base.databaseMap());
+
+    // Changing the map of the fork takes a private copy.
+
+  fork.createTable("projects");
+  BOOST_TEST(fork.databaseMap() != base.databaseMap());
+  BOOST_TEST(!base.databaseMap()->findTable("projects"));
+  BOOST_TEST(fork.databaseMap()->findTable("employees").has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterValidation)
+
+BOOST_AUTO_TEST_CASE(invalidNamesThrow)
+{
+  auto validatingWriter = []()
+  {
+    sqlWriter writer;
+
+    readDatabaseMap(writer);
+    writer.setValidation(true);
+    return writer;
+  };
+
+  BOOST_CHECK_THROW(validatingWriter().select({"bogus"}), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).from("bogus"), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).from("employees").where("bogus", "=", 1), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).from("employees").orderBy({{"bogus", sqlWriter::ASC}}),
+                    GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).from("employees").groupBy({"bogus"}), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"employees.bogus"}), GCL::runtime_error);
+  BOOST_CHECK_THROW(validatingWriter().select({"name"}).from("employees").where("bogus.name", "=", 1), GCL::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(validNamesMapped)
+{
+  sqlWriter writer;
+
+  readDatabaseMap(writer);
+  writer.setValidation(true);
+  writer.select({"deptID"}).from("employees", "e").where("e.name", "=", std::string("Bob"))
+        .groupBy({"deptID"}).orderBy({{"deptID", sqlWriter::ASC}});
+  BOOST_TEST(writer.string() ==
+             "SELECT dept_id FROM tbl_emp AS e WHERE (e.emp_name = 'Bob') GROUP BY dept_id ORDER BY dept_id ASC ");
+}
+
+BOOST_AUTO_TEST_CASE(wildcardsNotValidated)
+{
+  sqlWriter writer;
+
+  readDatabaseMap(writer);
+  writer.setValidation(true);
+  writer.select({"*", "COUNT(*)"}).from("employees");
+  BOOST_TEST(writer.string() == "SELECT *, COUNT(*) FROM tbl_emp");
+}
+
+BOOST_AUTO_TEST_CASE(unknownNamesAcceptedWithoutValidation)
+{
+  sqlWriter writer;
+
+  readDatabaseMap(writer);
+  writer.select({"bogus"}).from("other").where("missing", "=", 1).groupBy({"bogus"}).orderBy({{"bogus", sqlWriter::ASC}});
+  BOOST_TEST(writer.string() == "SELECT bogus FROM other WHERE (missing = 1) GROUP BY bogus ORDER BY bogus ASC ");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sqlWriterMap)
+
+BOOST_AUTO_TEST_CASE(joinTablesAndColumnsMapped)
+{
+  sqlWriter writer;
+
+  readDatabaseMap(writer);
+  writer.select({"name"}).from({"employees"}).join({std::make_tuple(std::string("employees"), std::string("deptID"),
+                                                                    sqlWriter::JOIN_INNER, std::string("departments"),
+                                                                    std::string("ID"))});
+  BOOST_TEST(writer.string() == "SELECT emp_name FROM tbl_emp INNER JOIN tbl_dept ON tbl_emp.dept_id=tbl_dept.dept_pk");
+}
+
+BOOST_AUTO_TEST_CASE(joinAliasMapped)
+{
+  sqlWriter writer;
+
+  readDatabaseMap(writer);
+  writer.select({"name"}).from("employees", "e").join({std::make_tuple(std::string("e"), std::string("deptID"),
+                                                                       sqlWriter::JOIN_LEFT, std::string("departments"),
+                                                                       std::string("ID"))});
+  BOOST_TEST(writer.string() == "SELECT emp_name FROM tbl_emp AS e LEFT JOIN tbl_dept ON e.dept_id=tbl_dept.dept_pk");
+}
+
+BOOST_AUTO_TEST_CASE(keysetValidatedColumnsMapped)
+{
+  sqlWriter writer;
+
+  readDatabaseMap(writer);
+  writer.setValidation(true);
+  writer.select({"name"}).from({"employees"}).orderBy({{"name", sqlWriter::ASC}}).keyset({"deptID"}, {}, 5);
+  BOOST_TEST(writer.string() == "SELECT emp_name FROM tbl_emp ORDER BY dept_id ASC, emp_name ASC LIMIT 5 ");
+}
+
+BOOST_AUTO_TEST_CASE(joinUnknownNamesUnchanged)
+{
+  sqlWriter writer;
+
+  readDatabaseMap(writer);
+  writer.select({"a"}).from({"t"}).join({std::make_tuple(std::string("t"), std::string("id"), sqlWriter::JOIN_INNER,
+                                                         std::string("employees"), std::string("other"))});
+  BOOST_TEST(writer.string() == "SELECT a FROM t INNER JOIN tbl_emp ON t.id=tbl_emp.other");
+}
+
+BOOST_AUTO_TEST_SUITE_END()